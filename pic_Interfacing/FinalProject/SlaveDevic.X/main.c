@@ -26,8 +26,9 @@
 #define HIGH_DUTY_CYCLE     (155.5 * 4 * 0.75)  // Duty cycle for high temperature state
 #define MAX_DUTY_CYCLE      (155.5 * 4)         // Duty cycle for maximum temperature state
 
-#define TRUE    1
-#define FALSE   0
+// Buttons on PORTC, pressed reads low; RC7 toggles the motor direction
+#define BUTTON_DIR_MASK     0x80
+#define BUTTONS_MASK        (BUTTON_DIR_MASK)
 
 /* 
  * ===========================
@@ -37,6 +38,28 @@
 volatile uint8_t i2c_received_data;          // Stores data received from the I2C bus
 volatile uint8_t i2c_interrupt_counter = 0;  // Counts the number of I2C interrupts
 
+static uint8_t buttons_state = 0;            // Debounced, bit set while the button is pressed
+static uint8_t buttons_count0 = 0xFF;        // Vertical counter, one 2-bit sample count
+static uint8_t buttons_count1 = 0xFF;        // per button spread over the two bytes
+static uint8_t buttons_pressed = 0;          // Press events not yet handled
+
+/* 
+ * ===========================
+ *       Button Service
+ * ===========================
+ */
+// Called every TMR2 period (~20 ms): one sample of every button on PORTC.
+// A button changes state after 4 equal samples, all buttons in a few byte operations.
+static void Buttons_Tick(void) {
+    uint8_t changed = (uint8_t)(buttons_state ^ (~PORTC & BUTTONS_MASK));
+
+    buttons_count0 = (uint8_t)~(buttons_count0 & changed);
+    buttons_count1 = (uint8_t)(buttons_count0 ^ (buttons_count1 & changed));
+    changed &= (uint8_t)(buttons_count0 & buttons_count1);
+    buttons_state ^= changed;
+    buttons_pressed |= (uint8_t)(changed & buttons_state);
+}
+
 /* 
  * ===========================
  *        I2C Callback
@@ -62,6 +85,7 @@ int main(void) {
      */
     SYSTEM_Initialize();  // Call the generated system initialization routine
     I2C1_CallbackRegister(I2C_InterruptHandler);  // Register the I2C interrupt handler
+    TMR2_OverflowCallbackRegister(Buttons_Tick);  // TMR2 also clocks the PWM, its period paces the buttons
 
     INTERRUPT_GlobalInterruptEnable();   // Enable global interrupts
     INTERRUPT_PeripheralInterruptEnable();  // Enable peripheral interrupts
@@ -69,23 +93,19 @@ int main(void) {
     // Initial motor direction
     Motor1_SetHigh(); 
     Motor2_SetLow();   
-    
-    uint8_t toggle_dir_flag = FALSE;  // Flag to track motor direction toggling, uses TRUE/FALSE
 
     /* ===========================
      *         Main Loop
      * ===========================
      */
     while (1) {
-        // Check button status (IO_RC7) for toggling motors
-        if (!(IO_RC7_GetValue())) {  // If button is pressed (value is low)
-            if (toggle_dir_flag == FALSE) {  // Use FALSE to check if the flag is cleared
-                toggle_dir_flag = TRUE;  // Set the flag to TRUE when motors are toggled
-                Motor1_Toggle();      // Toggle Motor1
-                Motor2_Toggle();      // Toggle Motor2
-            }
-        } else {
-            toggle_dir_flag = FALSE;  // Reset the flag to FALSE when the button is released
+        TMR2_Tasks();  // Runs Buttons_Tick once per TMR2 period
+
+        // Each debounced press of the direction button (IO_RC7) toggles the motors once
+        if (buttons_pressed & BUTTON_DIR_MASK) {
+            buttons_pressed &= (uint8_t)~BUTTON_DIR_MASK;
+            Motor1_Toggle();      // Toggle Motor1
+            Motor2_Toggle();      // Toggle Motor2
         }
 
         // Handle I2C interrupt events
@@ -0,0 +1,143 @@
+/*
+ * File:   eeprom_log.c
+ * Author: dell
+ *
+ * Created on October 17, 2026
+ */
+
+#include "eeprom_log.h"
+
+#define RECORDS_PER_PAGE    (EEPROM_LOG_PAGE_SIZE / EEPROM_LOG_RECORD_SIZE)
+#define CHECK_IND           (EEPROM_LOG_RECORD_SIZE - 1)
+
+static uint8_t pageBuffer[EEPROM_LOG_PAGE_SIZE];
+static uint8_t writeBuffer[EEPROM_LOG_PAGE_SIZE + 1];
+static uint8_t pageAddress = EEPROM_LOG_START;
+static uint8_t pageFill = 0;        /* bytes of pageBuffer holding records */
+static uint8_t pageFlushed = 0;     /* bytes of pageBuffer already in the EEPROM */
+static uint8_t nextSequence = 0;
+static uint8_t idleTicks = 0;
+
+static uint8_t eeprom_log_check(const uint8_t *record) {
+    uint8_t sum = 0;
+    for (uint8_t i = 0; i < CHECK_IND; i++) {
+        sum += record[i];
+    }
+    /* Inverted so an erased (all 0xFF) slot never looks valid */
+    return (uint8_t)~sum;
+}
+
+/*
+ * ACK polling: the EEPROM NACKs its address until the write cycle is over.
+ * Any other error is a bus fault and ends the wait as a failure.
+ */
+static bool eeprom_log_wait_ready(void) {
+    uint8_t wordAddress = pageAddress;
+    i2c_host_error_t error = I2C_ERROR_ADDR_NACK;
+    for (uint8_t tries = 0; (tries < EEPROM_LOG_POLL_MAX) && (error == I2C_ERROR_ADDR_NACK); tries++) {
+        /* Only loads the address pointer, does not start a write cycle */
+        I2C1_Write(EEPROM_LOG_I2C_ADDR, &wordAddress, 1);
+        while (I2C1_IsBusy());
+        error = I2C1_ErrorGet();
+    }
+    return error == I2C_ERROR_NONE;
+}
+
+static bool eeprom_log_read_slot(uint8_t slot, uint8_t *record) {
+    uint8_t wordAddress = (uint8_t)(EEPROM_LOG_START + slot * EEPROM_LOG_RECORD_SIZE);
+    I2C1_WriteRead(EEPROM_LOG_I2C_ADDR, &wordAddress, 1, record, EEPROM_LOG_RECORD_SIZE);
+    while (I2C1_IsBusy());
+    return (I2C1_ErrorGet() == I2C_ERROR_NONE) && (record[CHECK_IND] == eeprom_log_check(record));
+}
+
+void eeprom_log_init(void) {
+    uint8_t record[EEPROM_LOG_RECORD_SIZE];
+    uint8_t newestSlot = 0;
+    bool found = false;
+
+    /*
+     * Records are written in slot order with consecutive sequence numbers and
+     * the log restarts at slot 0 when it wraps, so the newest record is the end
+     * of the run that starts at the first valid slot.
+     */
+    for (uint8_t slot = 0; slot < EEPROM_LOG_SLOTS; slot++) {
+        bool valid = eeprom_log_read_slot(slot, record);
+        if (valid && (!found || (record[0] == nextSequence))) {
+            newestSlot = slot;
+            nextSequence = (uint8_t)(record[0] + 1);
+            found = true;
+        } else if (found) {
+            break;
+        }
+    }
+
+    uint8_t headSlot = found ? (uint8_t)((newestSlot + 1) % EEPROM_LOG_SLOTS) : 0;
+    pageAddress = (uint8_t)(EEPROM_LOG_START + (headSlot / RECORDS_PER_PAGE) * EEPROM_LOG_PAGE_SIZE);
+    pageFill = (uint8_t)((headSlot % RECORDS_PER_PAGE) * EEPROM_LOG_RECORD_SIZE);
+    pageFlushed = pageFill;
+    idleTicks = 0;
+}
+
+bool eeprom_log_flush(void) {
+    uint8_t length = (uint8_t)(pageFill - pageFlushed);
+
+    if (length == 0) {
+        return true;
+    }
+    /* One page write for everything new in this page */
+    writeBuffer[0] = (uint8_t)(pageAddress + pageFlushed);
+    for (uint8_t i = 0; i < length; i++) {
+        writeBuffer[i + 1] = pageBuffer[pageFlushed + i];
+    }
+    I2C1_Write(EEPROM_LOG_I2C_ADDR, writeBuffer, (size_t)length + 1);
+    while (I2C1_IsBusy());
+    if (I2C1_ErrorGet() != I2C_ERROR_NONE) {
+        return false;
+    }
+    pageFlushed = pageFill;
+    idleTicks = 0;
+
+    /* Full page: move on, wrapping around the log area */
+    if (pageFill == EEPROM_LOG_PAGE_SIZE) {
+        pageAddress = (uint8_t)(pageAddress + EEPROM_LOG_PAGE_SIZE);
+        if ((uint16_t)(pageAddress - EEPROM_LOG_START) >= EEPROM_LOG_SIZE) {
+            pageAddress = EEPROM_LOG_START;
+        }
+        pageFill = 0;
+        pageFlushed = 0;
+    }
+    return eeprom_log_wait_ready();
+}
+
+bool eeprom_log_append(const uint8_t *timeDate) {
+    /* A full page is still waiting if its write failed, retry it first */
+    if ((pageFill == EEPROM_LOG_PAGE_SIZE) && !eeprom_log_flush()) {
+        return false;
+    }
+
+    uint8_t *record = &pageBuffer[pageFill];
+    record[0] = nextSequence++;
+    record[1] = timeDate[SEC_IND];
+    record[2] = timeDate[MIN_IND];
+    record[3] = timeDate[HOUR_IND];
+    record[4] = timeDate[DAY_IND];
+    record[5] = timeDate[MONTH_IND];
+    record[6] = timeDate[YEAR_IND];
+    record[CHECK_IND] = eeprom_log_check(record);
+    pageFill += EEPROM_LOG_RECORD_SIZE;
+    idleTicks = 0;
+
+    if (pageFill == EEPROM_LOG_PAGE_SIZE) {
+        return eeprom_log_flush();
+    }
+    return true;
+}
+
+void eeprom_log_tick(void) {
+    if (pageFill != pageFlushed) {
+        idleTicks++;
+        if (idleTicks >= EEPROM_LOG_FLUSH_TICKS) {
+            eeprom_log_flush();
+        }
+    }
+}
@@ -0,0 +1,50 @@
+/* 
+ * File:   eeprom_log.h
+ * Author: dell
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef EEPROM_LOG_H
+#define	EEPROM_LOG_H
+
+#include "../../mcc_generated_files/system/system.h"
+#include "../RTC/rtc.h"
+
+/* 24C02C: 256 bytes, 16-byte write page, one address byte */
+#define EEPROM_LOG_I2C_ADDR     0x50
+#define EEPROM_LOG_START        0x00
+#define EEPROM_LOG_SIZE         256
+#define EEPROM_LOG_PAGE_SIZE    16
+
+/* Record: seq, sec, min, hour, day, month, year, check */
+#define EEPROM_LOG_RECORD_SIZE  8
+#define EEPROM_LOG_SLOTS        (EEPROM_LOG_SIZE / EEPROM_LOG_RECORD_SIZE)
+
+/* Timer ticks a partly filled page may wait in RAM before it is written anyway */
+#define EEPROM_LOG_FLUSH_TICKS  5
+/* ACK polling attempts before a write cycle is considered stuck */
+#define EEPROM_LOG_POLL_MAX     200
+
+/*
+ * Scans the EEPROM for the newest valid record and continues the log after it.
+ */
+void eeprom_log_init(void);
+
+/*
+ * Queues one time/date record (DATA_LENGTH bytes as read from the RTC).
+ * The page is written as soon as it is full.
+ */
+bool eeprom_log_append(const uint8_t *timeDate);
+
+/*
+ * Writes whatever is buffered for the current page.
+ */
+bool eeprom_log_flush(void);
+
+/*
+ * Call once per timer tick, flushes a partly filled page after EEPROM_LOG_FLUSH_TICKS.
+ */
+void eeprom_log_tick(void);
+
+#endif	/* EEPROM_LOG_H */
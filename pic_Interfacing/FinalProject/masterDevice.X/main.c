@@ -11,26 +11,23 @@
  * @details This code initializes the system, manages global interrupts,
  *          handles temperature reading from a sensor, and updates/display
  *          time data. The temperature state is managed, and an alarm is triggered
- *          when certain thresholds are met. Data is saved to external EEPROM via I2C.
+ *          when certain thresholds are met. Alarm times are kept in a circular
+ *          log on the external EEPROM via I2C.
  */
 
 /* Include necessary header files */
 #include "mcc_generated_files/system/system.h"
 #include "ECU_Layer/RTC/rtc.h"
 #include "ECU_Layer/DISP/disp.h"
+#include "ECU_Layer/LOG/eeprom_log.h"
 #include "../Shared/sharedData.h"
 
 /* Define Macros */
 #define TEMP_SENSOR_ADDR      0x4D        // I2C address for temperature sensor
-#define EEPROM_ADDR           0x50        // I2C address for external EEPROM
 #define SLAVE_MCU_ADDR        0x8         // I2C address for slave microcontroller
 #define ALARM_THRESHOLD_IDLE   45          // Temperature threshold for idle state
 #define ALARM_THRESHOLD_HIGH   50          // Temperature threshold for high state
-#define EEPROM_DEFAULT_ADDR    0x08       // Default starting EEPROM address
-#define EEPROM_INCREMENT       8           // EEPROM address increment value
 #define TEMP_POLL_DELAY_MS     200        // Temperature polling delay in ms
-#define EEPROM_DELAY_MS        10          // Delay after writing to EEPROM
-#define EEPROM_READ_FAILURE    0xFF        // Default value for EEPROM read failure
 #define TIMER_TICK_INIT        1           // Initial value of timer ticks
 #define DATA_LENGTH            7           // Length of the data array
 
@@ -48,7 +45,6 @@ volatile uint8_t temperature = 0;                      // Current temperature re
 uint8_t temperatureAddress = 0x00;                     // Address for temperature sensor communication
 uint8_t temperatureState = temp_state_idle;            // Current temperature state
 uint8_t previousTemperatureState = temp_state_idle;    // Previous temperature state
-uint8_t externalEEPROMAddress = 0x00;                  // Current EEPROM address for logging
 
 /*
  * @brief Main function: entry point of the application
@@ -66,13 +62,8 @@ int main(void) {
     INTERRUPT_GlobalInterruptEnable();
     INTERRUPT_PeripheralInterruptEnable();
     
-    // Initialize EEPROM address
-    I2C1_WriteRead(EEPROM_ADDR, &externalEEPROMAddress, 1, &externalEEPROMAddress, 1);
-    while (I2C1_IsBusy());
-
-    if (externalEEPROMAddress == EEPROM_READ_FAILURE) {
-        externalEEPROMAddress = EEPROM_DEFAULT_ADDR; // Set to default if read fails
-    }
+    // Find where the EEPROM log left off
+    eeprom_log_init();
 
     /* ===========================
      *         Main Loop
@@ -85,6 +76,9 @@ int main(void) {
             // Update RTC time and display it via UART
             rtc_update_time(timeDate);
             disp_display_uart_time_date(timeDate);
+
+            // Write a partly filled log page once logging goes quiet
+            eeprom_log_tick();
         }
 
         // Read temperature from sensor
@@ -116,23 +110,12 @@ int main(void) {
                 // Display
                 disp_display_uart_ascii("Alarm!!\r");
                 
-                // Log critical temperature time and save to EEPROM
-                timeDate[RESERVED] = timeDate[HOUR_IND];
-                timeDate[HOUR_IND] = timeDate[MIN_IND];
-                timeDate[MIN_IND] = timeDate[SEC_IND];
-                timeDate[SEC_IND] = externalEEPROMAddress;  // Log current EEPROM address
-                externalEEPROMAddress += EEPROM_INCREMENT;   // Increment EEPROM address for next write
-
-                I2C1_Write(EEPROM_ADDR, &timeDate, DATA_LENGTH); // Save time data to EEPROM
-                while (I2C1_IsBusy());
-                __delay_ms(EEPROM_DELAY_MS);
-
-                // Save updated EEPROM address pointer
-                timeDate[SEC_IND] = 0x00; // Reset seconds for EEPROM
-                timeDate[MIN_IND] = externalEEPROMAddress; // Update EEPROM address in timeDate
-                I2C1_Write(EEPROM_ADDR, &timeDate, 2); // Save updated address
-                while (I2C1_IsBusy());
-                __delay_ms(EEPROM_DELAY_MS);
+                // Log critical temperature time, pages are written to EEPROM when full
+                uint8_t record[DATA_LENGTH];
+                for (uint8_t i = 0; i < DATA_LENGTH; i++) {
+                    record[i] = timeDate[i];
+                }
+                eeprom_log_append(record);
             } else {
                 Alarm_SetLow();  // Reset the alarm if not in max state
             }
@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=mcc_generated_files/system/src/system.c mcc_generated_files/timer/src/tmr0.c mcc_generated_files/uart/src/eusart.c mcc_generated_files/system/src/pins.c mcc_generated_files/system/src/config_bits.c mcc_generated_files/system/src/interrupt.c mcc_generated_files/system/src/clock.c main.c mcc_generated_files/i2c_host/src/mssp.c ECU_Layer/RTC/rtc.c ECU_Layer/DISP/disp.c
+SOURCEFILES_QUOTED_IF_SPACED=mcc_generated_files/system/src/system.c mcc_generated_files/timer/src/tmr0.c mcc_generated_files/uart/src/eusart.c mcc_generated_files/system/src/pins.c mcc_generated_files/system/src/config_bits.c mcc_generated_files/system/src/interrupt.c mcc_generated_files/system/src/clock.c main.c mcc_generated_files/i2c_host/src/mssp.c ECU_Layer/RTC/rtc.c ECU_Layer/DISP/disp.c ECU_Layer/LOG/eeprom_log.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/mcc_generated_files/system/src/system.p1 ${OBJECTDIR}/mcc_generated_files/timer/src/tmr0.p1 ${OBJECTDIR}/mcc_generated_files/uart/src/eusart.p1 ${OBJECTDIR}/mcc_generated_files/system/src/pins.p1 ${OBJECTDIR}/mcc_generated_files/system/src/config_bits.p1 ${OBJECTDIR}/mcc_generated_files/system/src/interrupt.p1 ${OBJECTDIR}/mcc_generated_files/system/src/clock.p1 ${OBJECTDIR}/main.p1 ${OBJECTDIR}/mcc_generated_files/i2c_host/src/mssp.p1 ${OBJECTDIR}/ECU_Layer/RTC/rtc.p1 ${OBJECTDIR}/ECU_Layer/DISP/disp.p1
-POSSIBLE_DEPFILES=${OBJECTDIR}/mcc_generated_files/system/src/system.p1.d ${OBJECTDIR}/mcc_generated_files/timer/src/tmr0.p1.d ${OBJECTDIR}/mcc_generated_files/uart/src/eusart.p1.d ${OBJECTDIR}/mcc_generated_files/system/src/pins.p1.d ${OBJECTDIR}/mcc_generated_files/system/src/config_bits.p1.d ${OBJECTDIR}/mcc_generated_files/system/src/interrupt.p1.d ${OBJECTDIR}/mcc_generated_files/system/src/clock.p1.d ${OBJECTDIR}/main.p1.d ${OBJECTDIR}/mcc_generated_files/i2c_host/src/mssp.p1.d ${OBJECTDIR}/ECU_Layer/RTC/rtc.p1.d ${OBJECTDIR}/ECU_Layer/DISP/disp.p1.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/mcc_generated_files/system/src/system.p1 ${OBJECTDIR}/mcc_generated_files/timer/src/tmr0.p1 ${OBJECTDIR}/mcc_generated_files/uart/src/eusart.p1 ${OBJECTDIR}/mcc_generated_files/system/src/pins.p1 ${OBJECTDIR}/mcc_generated_files/system/src/config_bits.p1 ${OBJECTDIR}/mcc_generated_files/system/src/interrupt.p1 ${OBJECTDIR}/mcc_generated_files/system/src/clock.p1 ${OBJECTDIR}/main.p1 ${OBJECTDIR}/mcc_generated_files/i2c_host/src/mssp.p1 ${OBJECTDIR}/ECU_Layer/RTC/rtc.p1 ${OBJECTDIR}/ECU_Layer/DISP/disp.p1 ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1
+POSSIBLE_DEPFILES=${OBJECTDIR}/mcc_generated_files/system/src/system.p1.d ${OBJECTDIR}/mcc_generated_files/timer/src/tmr0.p1.d ${OBJECTDIR}/mcc_generated_files/uart/src/eusart.p1.d ${OBJECTDIR}/mcc_generated_files/system/src/pins.p1.d ${OBJECTDIR}/mcc_generated_files/system/src/config_bits.p1.d ${OBJECTDIR}/mcc_generated_files/system/src/interrupt.p1.d ${OBJECTDIR}/mcc_generated_files/system/src/clock.p1.d ${OBJECTDIR}/main.p1.d ${OBJECTDIR}/mcc_generated_files/i2c_host/src/mssp.p1.d ${OBJECTDIR}/ECU_Layer/RTC/rtc.p1.d ${OBJECTDIR}/ECU_Layer/DISP/disp.p1.d ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/mcc_generated_files/system/src/system.p1 ${OBJECTDIR}/mcc_generated_files/timer/src/tmr0.p1 ${OBJECTDIR}/mcc_generated_files/uart/src/eusart.p1 ${OBJECTDIR}/mcc_generated_files/system/src/pins.p1 ${OBJECTDIR}/mcc_generated_files/system/src/config_bits.p1 ${OBJECTDIR}/mcc_generated_files/system/src/interrupt.p1 ${OBJECTDIR}/mcc_generated_files/system/src/clock.p1 ${OBJECTDIR}/main.p1 ${OBJECTDIR}/mcc_generated_files/i2c_host/src/mssp.p1 ${OBJECTDIR}/ECU_Layer/RTC/rtc.p1 ${OBJECTDIR}/ECU_Layer/DISP/disp.p1
+OBJECTFILES=${OBJECTDIR}/mcc_generated_files/system/src/system.p1 ${OBJECTDIR}/mcc_generated_files/timer/src/tmr0.p1 ${OBJECTDIR}/mcc_generated_files/uart/src/eusart.p1 ${OBJECTDIR}/mcc_generated_files/system/src/pins.p1 ${OBJECTDIR}/mcc_generated_files/system/src/config_bits.p1 ${OBJECTDIR}/mcc_generated_files/system/src/interrupt.p1 ${OBJECTDIR}/mcc_generated_files/system/src/clock.p1 ${OBJECTDIR}/main.p1 ${OBJECTDIR}/mcc_generated_files/i2c_host/src/mssp.p1 ${OBJECTDIR}/ECU_Layer/RTC/rtc.p1 ${OBJECTDIR}/ECU_Layer/DISP/disp.p1 ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1
 
 # Source Files
-SOURCEFILES=mcc_generated_files/system/src/system.c mcc_generated_files/timer/src/tmr0.c mcc_generated_files/uart/src/eusart.c mcc_generated_files/system/src/pins.c mcc_generated_files/system/src/config_bits.c mcc_generated_files/system/src/interrupt.c mcc_generated_files/system/src/clock.c main.c mcc_generated_files/i2c_host/src/mssp.c ECU_Layer/RTC/rtc.c ECU_Layer/DISP/disp.c
+SOURCEFILES=mcc_generated_files/system/src/system.c mcc_generated_files/timer/src/tmr0.c mcc_generated_files/uart/src/eusart.c mcc_generated_files/system/src/pins.c mcc_generated_files/system/src/config_bits.c mcc_generated_files/system/src/interrupt.c mcc_generated_files/system/src/clock.c main.c mcc_generated_files/i2c_host/src/mssp.c ECU_Layer/RTC/rtc.c ECU_Layer/DISP/disp.c ECU_Layer/LOG/eeprom_log.c
 
 
 
@@ -176,6 +176,14 @@ ${OBJECTDIR}/ECU_Layer/DISP/disp.p1: ECU_Layer/DISP/disp.c  nbproject/Makefile-$
 	@-${MV} ${OBJECTDIR}/ECU_Layer/DISP/disp.d ${OBJECTDIR}/ECU_Layer/DISP/disp.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/DISP/disp.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1: ECU_Layer/LOG/eeprom_log.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/LOG" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1 ECU_Layer/LOG/eeprom_log.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.d ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 else
 ${OBJECTDIR}/mcc_generated_files/system/src/system.p1: mcc_generated_files/system/src/system.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/mcc_generated_files/system/src" 
@@ -265,6 +273,14 @@ ${OBJECTDIR}/ECU_Layer/DISP/disp.p1: ECU_Layer/DISP/disp.c  nbproject/Makefile-$
 	@-${MV} ${OBJECTDIR}/ECU_Layer/DISP/disp.d ${OBJECTDIR}/ECU_Layer/DISP/disp.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/DISP/disp.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1: ECU_Layer/LOG/eeprom_log.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/LOG" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1 ECU_Layer/LOG/eeprom_log.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.d ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/LOG/eeprom_log.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 endif
 
 # ------------------------------------------------------------------------------------
@@ -27,7 +27,7 @@
  *         - E_OK: The operation was successful.
  *         - E_NOT_OK: An error occurred during the operation.
  */
-Std_ReturnType seven_seg_init(const seg_t *seg) {
+Std_ReturnType seven_seg_init(seg_t *seg) {
     Std_ReturnType ret = E_OK;
 
     if (NULL == seg) {
@@ -37,6 +37,7 @@ Std_ReturnType seven_seg_init(const seg_t *seg) {
         ret = gpio_pin_initialize(&(seg->seg_pins[SEGMENT_PIN1]));
         ret = gpio_pin_initialize(&(seg->seg_pins[SEGMENT_PIN2]));
         ret = gpio_pin_initialize(&(seg->seg_pins[SEGMENT_PIN3]));
+        ret = gpio_pin_group_init(&(seg->seg_group), seg->seg_pins, 4);
     }
 
     return ret;
@@ -57,10 +58,8 @@ Std_ReturnType seven_seg_write_number(const seg_t *seg, uint8 number) {
     if (NULL == seg || number > 9) {
         ret = E_NOT_OK;
     } else {
-        ret = gpio_pin_write(&(seg->seg_pins[SEGMENT_PIN0]), number & 0x01);
-        ret = gpio_pin_write(&(seg->seg_pins[SEGMENT_PIN1]), number >> 1 & 0x01);
-        ret = gpio_pin_write(&(seg->seg_pins[SEGMENT_PIN2]), number >> 2 & 0x01);
-        ret = gpio_pin_write(&(seg->seg_pins[SEGMENT_PIN3]), number >> 3 & 0x01);
+        //All four BCD lines change together, the decoder never sees a mixed digit
+        ret = gpio_pin_group_write(&(seg->seg_group), number);
     }
 
     return ret;
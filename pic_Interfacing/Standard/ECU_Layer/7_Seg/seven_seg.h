@@ -47,6 +47,7 @@ typedef struct
 {
     pin_config_t seg_pins[4];
     seg_type_t seg_type;
+    gpio_pin_group_t seg_group;     // Filled by seven_seg_init from seg_pins
 }seg_t;
 
 
@@ -61,7 +62,7 @@ typedef struct
  *         - E_OK: The operation was successful.
  *         - E_NOT_OK: An error occurred during the operation.
  */
-Std_ReturnType seven_seg_init(const seg_t *seg);
+Std_ReturnType seven_seg_init(seg_t *seg);
 
 /**
  * @brief Writes a number to a 7-segment display.
@@ -12,6 +12,11 @@
 
 #include "button.h"
 
+//=========================================================================
+//                           Static Declarations
+//=========================================================================
+
+
 //=========================================================================
 //                           Functions Definitions
 //=========================================================================
@@ -89,3 +94,178 @@ Std_ReturnType button_read_state(const button_t *btn, button_state_t *state)
 
     return ret;
 }
+
+/**
+ * @brief Initializes every button and a service that debounces them together.
+ * 
+ * @param service A pointer to the service state.
+ * @param buttons The buttons, buttons[n] is button n of the events. Copied.
+ * @param count Number of buttons, 1 to BUTTON_SERVICE_MAX_BUTTONS.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType button_service_init(button_service_t *service, const button_t *buttons, uint8 count)
+{
+    Std_ReturnType ret = E_OK;
+    pin_config_t pins[BUTTON_SERVICE_MAX_BUTTONS];
+
+    if(NULL == service || NULL == buttons || 0 == count || count > BUTTON_SERVICE_MAX_BUTTONS)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        service->active_low = 0;
+        for(uint8 index = 0; index < count; index++)
+        {
+            pins[index] = buttons[index].pin;
+            if(BUTTON_ACTIVE_LOW == buttons[index].button_connection)
+            {
+                service->active_low |= (uint8)(1U << index);
+            }
+            service->hold_ticks[index] = 0;
+            ret &= button_init(&buttons[index]);
+        }
+        ret &= gpio_pin_group_init(&service->pins, pins, count);
+
+        /* All released, the counters start full so 4 samples are needed to change */
+        service->state = 0;
+        service->count0 = 0xFF;
+        service->count1 = 0xFF;
+        service->long_pressed = 0;
+        ret &= event_queue_init(&service->event_queue, service->events, BUTTON_EVENT_QUEUE_SIZE);
+    }
+    return ret;
+}
+
+/**
+ * @brief Samples every button once and queues their events, meant for a periodic tick.
+ * 
+ * One read per port and a handful of byte wide operations debounce all the
+ * buttons at once, whatever their number. 5 to 20 ms is a typical period.
+ * 
+ * @param service A pointer to the service state.
+ */
+void button_service_tick(button_service_t *service)
+{
+    uint8 sample = 0;
+    uint8 changed;
+    uint8 held;
+
+    if(NULL == service)
+    {
+        /* Nothing */
+    }
+    else
+    {
+        (void)gpio_pin_group_read(&service->pins, &sample);
+        sample ^= service->active_low;
+
+        /*
+         * Vertical counter: bit n of count1:count0 counts down the samples of
+         * button n that disagree with its state and reloads on any that agrees.
+         * Buttons whose count wraps after 4 samples in a row change state.
+         */
+        changed = (uint8)(service->state ^ sample);
+        service->count0 = (uint8)~(service->count0 & changed);
+        service->count1 = (uint8)(service->count0 ^ (service->count1 & changed));
+        changed &= (uint8)(service->count0 & service->count1);
+        service->state ^= changed;
+
+        for(uint8 index = 0; changed; index++, changed >>= 1)
+        {
+            if(changed & 0x01)
+            {
+                if(service->state & (1U << index))
+                {
+                    service->hold_ticks[index] = 0;
+                    event_queue_push(&service->event_queue, index, BUTTON_EVENT_PRESS);
+                }
+                else
+                {
+                    service->long_pressed &= (uint8)~(1U << index);
+                    event_queue_push(&service->event_queue, index, BUTTON_EVENT_RELEASE);
+                }
+            }
+        }
+
+        /* Only the buttons held down cost a loop pass */
+        held = service->state;
+        for(uint8 index = 0; held; index++, held >>= 1)
+        {
+            if(held & 0x01)
+            {
+                service->hold_ticks[index]++;
+                if(0 == (service->long_pressed & (1U << index)))
+                {
+                    if(service->hold_ticks[index] >= BUTTON_LONG_PRESS_TICKS)
+                    {
+                        service->long_pressed |= (uint8)(1U << index);
+                        service->hold_ticks[index] = 0;
+                        event_queue_push(&service->event_queue, index, BUTTON_EVENT_LONG_PRESS);
+                    }
+                }
+                else if(service->hold_ticks[index] >= BUTTON_REPEAT_PERIOD_TICKS)
+                {
+                    service->hold_ticks[index] = 0;
+                    event_queue_push(&service->event_queue, index, BUTTON_EVENT_REPEAT);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Takes the oldest event queued by button_service_tick.
+ * 
+ * @param service A pointer to the service state.
+ * @param event A pointer to store the event.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: An event was taken.
+ *         - E_NOT_OK: The queue is empty, or a NULL pointer.
+ */
+Std_ReturnType button_service_get_event(button_service_t *service, button_event_t *event)
+{
+    Std_ReturnType ret = E_OK;
+    event_queue_event_t queued;
+
+    if(NULL == service || NULL == event)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = event_queue_pop(&service->event_queue, &queued);
+        if(E_OK == ret)
+        {
+            event->button = queued.source;
+            event->type = queued.type;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the debounced state of every button.
+ * 
+ * @param service A pointer to the service state.
+ * @param pressed A pointer to store the states, bit n set while button n is pressed.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType button_service_get_state(const button_service_t *service, uint8 *pressed)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == service || NULL == pressed)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *pressed = service->state;
+    }
+    return ret;
+}
@@ -18,11 +18,21 @@
 //=========================================================================
 
 #include "../../MCAL_Layer/GPIO/gpio.h"
+#include "../Event_Queue/event_queue.h"
 #include "button_cfg.h"
 
 //=========================================================================
 //                           Macro Declarations
 //=========================================================================
+/* One bit per button in the vertical counter bytes */
+#define BUTTON_SERVICE_MAX_BUTTONS      8
+
+#if ((BUTTON_EVENT_QUEUE_SIZE & (BUTTON_EVENT_QUEUE_SIZE - 1U)) != 0U) || (BUTTON_EVENT_QUEUE_SIZE > EVENT_QUEUE_MAX_SIZE)
+#error "BUTTON_EVENT_QUEUE_SIZE must be a power of two up to EVENT_QUEUE_MAX_SIZE"
+#endif
+#if (BUTTON_LONG_PRESS_TICKS < 1) || (BUTTON_LONG_PRESS_TICKS + BUTTON_REPEAT_PERIOD_TICKS > 255)
+#error "BUTTON_LONG_PRESS_TICKS + BUTTON_REPEAT_PERIOD_TICKS must fit in 8 bits"
+#endif
 
 //=========================================================================
 //                           Macro Functions Declarations
@@ -51,6 +61,33 @@ typedef struct
     button_active_t button_connection;
 } button_t;
 
+typedef enum
+{
+    BUTTON_EVENT_PRESS = 0,
+    BUTTON_EVENT_RELEASE,
+    BUTTON_EVENT_LONG_PRESS,
+    BUTTON_EVENT_REPEAT
+} button_event_type_t;
+
+typedef struct
+{
+    uint8 button;   // Index of the button in the array given to button_service_init
+    uint8 type;     // @ref button_event_type_t
+} button_event_t;
+
+typedef struct
+{
+    gpio_pin_group_t pins;                              // Bit n is button n
+    uint8 active_low;                                   // Bit n set when button n reads low while pressed
+    uint8 state;                                        // Bit n set while button n is pressed, debounced
+    uint8 count0;                                       // Vertical counter, bit n of both is the
+    uint8 count1;                                       // 2-bit sample count of button n
+    uint8 long_pressed;                                 // Bit n set once button n reported its long press
+    uint8 hold_ticks[BUTTON_SERVICE_MAX_BUTTONS];       // Ticks button n has been held
+    event_queue_event_t events[BUTTON_EVENT_QUEUE_SIZE];
+    event_queue_t event_queue;                          // Filled by button_service_tick, emptied by button_service_get_event
+} button_service_t;
+
 //=========================================================================
 //                           Functions Declarations
 //=========================================================================
@@ -76,4 +113,48 @@ Std_ReturnType button_init(const button_t *btn);
  */
 Std_ReturnType button_read_state(const button_t *btn, button_state_t *state);
 
+/**
+ * @brief Initializes every button and a service that debounces them together.
+ * 
+ * @param service A pointer to the service state.
+ * @param buttons The buttons, buttons[n] is button n of the events. Copied.
+ * @param count Number of buttons, 1 to BUTTON_SERVICE_MAX_BUTTONS.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType button_service_init(button_service_t *service, const button_t *buttons, uint8 count);
+
+/**
+ * @brief Samples every button once and queues their events, meant for a periodic tick.
+ * 
+ * One read per port and a handful of byte wide operations debounce all the
+ * buttons at once, whatever their number. 5 to 20 ms is a typical period.
+ * 
+ * @param service A pointer to the service state.
+ */
+void button_service_tick(button_service_t *service);
+
+/**
+ * @brief Takes the oldest event queued by button_service_tick.
+ * 
+ * @param service A pointer to the service state.
+ * @param event A pointer to store the event.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: An event was taken.
+ *         - E_NOT_OK: The queue is empty, or a NULL pointer.
+ */
+Std_ReturnType button_service_get_event(button_service_t *service, button_event_t *event);
+
+/**
+ * @brief Reads the debounced state of every button.
+ * 
+ * @param service A pointer to the service state.
+ * @param pressed A pointer to store the states, bit n set while button n is pressed.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType button_service_get_state(const button_service_t *service, uint8 *pressed);
+
 #endif /* BUTTON_H */
@@ -15,7 +15,13 @@
 //=========================================================================
 //                           Macro Declarations
 //=========================================================================
-
+/* Button service: a press or release is reported after 4 equal samples, one
+ * sample per button_service_tick(). Then, while held, a long press after
+ * BUTTON_LONG_PRESS_TICKS and a repeat every BUTTON_REPEAT_PERIOD_TICKS. */
+#define BUTTON_LONG_PRESS_TICKS         100
+#define BUTTON_REPEAT_PERIOD_TICKS      20
+/* Pending events, must be a power of two */
+#define BUTTON_EVENT_QUEUE_SIZE         8U
 
 //=========================================================================
 //                           Macro Functions Declarations
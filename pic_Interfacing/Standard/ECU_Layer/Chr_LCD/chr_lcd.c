@@ -16,9 +16,45 @@
 static Std_ReturnType lcd_send_4bits(const lcd_4bit_t *lcd, uint8 _data_cmd);
 static Std_ReturnType lcd_4bits_send_enable_signal(const lcd_4bit_t *lcd);
 static Std_ReturnType lcd_4bit_set_cursor(const lcd_4bit_t *lcd, uint8 row, uint8 column);
+static Std_ReturnType lcd_4bit_wait_ready(const lcd_4bit_t *lcd, uint8 long_cmd);
+static Std_ReturnType lcd_4bit_send_init_cmd(const lcd_4bit_t *lcd, uint8 cmd);
+#if CHR_LCD_RW_PIN==CONFIG_ENABLE
+static Std_ReturnType lcd_4bit_read_busy(const lcd_4bit_t *lcd, uint8 *busy);
+#endif
+#if CHR_LCD_FRAME_BUFFER==CONFIG_ENABLE
+static Std_ReturnType lcd_4bit_fb_next_cell(lcd_4bit_fb_t *fb);
+#endif
 #elif defined(EIGHT_BIT_MODE)
 static Std_ReturnType lcd_8bits_send_enable_signal(const lcd_8bit_t *lcd);
 static Std_ReturnType lcd_8bit_set_cursor(const lcd_8bit_t *lcd, uint8 row, uint8 column);
+static Std_ReturnType lcd_8bit_wait_ready(const lcd_8bit_t *lcd, uint8 long_cmd);
+static Std_ReturnType lcd_8bit_send_init_cmd(const lcd_8bit_t *lcd, uint8 cmd);
+#if CHR_LCD_RW_PIN==CONFIG_ENABLE
+static Std_ReturnType lcd_8bit_read_busy(const lcd_8bit_t *lcd, uint8 *busy);
+#endif
+#endif
+
+/* Clear display and return home take ~1.52 ms, everything else ~37 us */
+#define LCD_IS_LONG_CMD(CMD)        (0U == ((CMD) & 0xFCU))
+
+#if defined(FOUR_BIT_MODE) && CHR_LCD_FRAME_BUFFER==CONFIG_ENABLE
+//==============================================================
+//                    Frame Buffer Definitions
+//==============================================================
+
+/* Nibble the tick sends next */
+#define LCD_FB_IDLE                 0
+#define LCD_FB_CMD_HIGH             1
+#define LCD_FB_CMD_LOW              2
+#define LCD_FB_DATA_HIGH            3
+#define LCD_FB_DATA_LOW             4
+
+#define LCD_FB_CURSOR_UNKNOWN       0xFF
+
+/* Wraps without a division, the tick runs in an ISR */
+#define LCD_FB_NEXT_ROW(ROW)        ((uint8) (((ROW) + 1U >= CHR_LCD_FB_ROWS) ? 0U : ((ROW) + 1U)))
+
+static const uint8 lcd_fb_row_start[4] = {ROW1_START, ROW2_START, ROW3_START, ROW4_START};
 #endif
 
 //==============================================================
@@ -41,24 +77,30 @@ Std_ReturnType lcd_4bit_init(lcd_4bit_t *lcd) {
 
         ret = gpio_pin_initialize(&(lcd->lcd_rs));
         ret = gpio_pin_initialize(&(lcd->lcd_en));
+#if CHR_LCD_RW_PIN==CONFIG_ENABLE
+        lcd->lcd_rw.direction = GPIO_DIRECTION_OUTPUT;
+        lcd->lcd_rw.logic = GPIO_LOW;
+        ret = gpio_pin_initialize(&(lcd->lcd_rw));
+#endif
         for (pins_counter = ZERO_INIT; pins_counter < FOUR_BIT_NUMBER; pins_counter++) {
             lcd->lcd_data[pins_counter].direction = GPIO_DIRECTION_OUTPUT;
             lcd->lcd_data[pins_counter].logic = GPIO_LOW;
             ret = gpio_pin_initialize(&(lcd->lcd_data[pins_counter]));
         }
+        ret = gpio_pin_group_init(&(lcd->lcd_data_group), lcd->lcd_data, FOUR_BIT_NUMBER);
         __delay_ms(20);
-        ret = lcd_4bit_send_cmd(lcd, LCD_8BIT_MODE_2_LINES);
+        ret = lcd_4bit_send_init_cmd(lcd, LCD_8BIT_MODE_2_LINES);
         __delay_ms(5);
-        ret = lcd_4bit_send_cmd(lcd, LCD_8BIT_MODE_2_LINES);
+        ret = lcd_4bit_send_init_cmd(lcd, LCD_8BIT_MODE_2_LINES);
         __delay_us(120);
-        ret = lcd_4bit_send_cmd(lcd, LCD_8BIT_MODE_2_LINES);
-
-        ret = lcd_4bit_send_cmd(lcd, LCD_CLEAR);
-        __delay_ms(1);
-        ret = lcd_4bit_send_cmd(lcd, LCD_RETURN_HOME);
-        ret = lcd_4bit_send_cmd(lcd, LCD_ENTRY_MODE);
-        ret = lcd_4bit_send_cmd(lcd, LCD_CURSOR_OFF_DISPLAY_ON);
-        ret = lcd_4bit_send_cmd(lcd, LCD_4BIT_MODE_2_LINES);
+        ret = lcd_4bit_send_init_cmd(lcd, LCD_8BIT_MODE_2_LINES);
+
+        ret = lcd_4bit_send_init_cmd(lcd, LCD_CLEAR);
+        ret = lcd_4bit_send_init_cmd(lcd, LCD_RETURN_HOME);
+        ret = lcd_4bit_send_init_cmd(lcd, LCD_ENTRY_MODE);
+        ret = lcd_4bit_send_init_cmd(lcd, LCD_CURSOR_OFF_DISPLAY_ON);
+        ret = lcd_4bit_send_init_cmd(lcd, LCD_4BIT_MODE_2_LINES);
+        //The busy flag reads right from here on
         ret = lcd_4bit_send_cmd(lcd, LCD_DDRAM_START);
     }
     return ret;
@@ -81,6 +123,7 @@ Std_ReturnType lcd_4bit_send_cmd(const lcd_4bit_t *lcd, uint8 cmd) {
 
         ret = lcd_send_4bits(lcd, cmd);
         ret = lcd_4bits_send_enable_signal(lcd);
+        ret = lcd_4bit_wait_ready(lcd, LCD_IS_LONG_CMD(cmd));
     }
     return ret;
 }
@@ -102,6 +145,7 @@ Std_ReturnType lcd_4bit_send_char(const lcd_4bit_t *lcd, uint8 data) {
 
         ret = lcd_send_4bits(lcd, data);
         ret = lcd_4bits_send_enable_signal(lcd);
+        ret = lcd_4bit_wait_ready(lcd, 0);
     }
     return ret;
 }
@@ -160,13 +204,143 @@ Std_ReturnType lcd_4bit_send_custom_char(const lcd_4bit_t *lcd, const uint8 chr[
     return ret;
 }
 
+#if CHR_LCD_FRAME_BUFFER==CONFIG_ENABLE
+//==============================================================
+//                4-Bit Mode Frame Buffer Functions
+//==============================================================
+
+Std_ReturnType lcd_4bit_fb_init(lcd_4bit_fb_t *fb, const lcd_4bit_t *lcd) {
+    Std_ReturnType ret = E_OK;
+    uint8 row = ZERO_INIT, column = ZERO_INIT;
+
+    if (NULL == fb || NULL == lcd) {
+        ret = E_NOT_OK;
+    } else {
+        //lcd_4bit_init leaves the display cleared, so both copies start blank
+        for (row = ZERO_INIT; row < CHR_LCD_FB_ROWS; row++) {
+            for (column = ZERO_INIT; column < CHR_LCD_FB_COLUMNS; column++) {
+                fb->frame[row][column] = ' ';
+                fb->shown[row][column] = ' ';
+            }
+        }
+        fb->lcd = lcd;
+        fb->dirty_rows = 0;
+        fb->row = 0;
+        fb->column = 0;
+        fb->cursor_row = LCD_FB_CURSOR_UNKNOWN;
+        fb->cursor_column = 0;
+        fb->phase = LCD_FB_IDLE;
+    }
+    return ret;
+}
+
+Std_ReturnType lcd_4bit_fb_send_char_pos(lcd_4bit_fb_t *fb, uint8 data, uint8 row, uint8 column) {
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == fb || row < ROW1 || row > CHR_LCD_FB_ROWS || column < 1 || column > CHR_LCD_FB_COLUMNS) {
+        ret = E_NOT_OK;
+    } else {
+        row--;
+        column--;
+        //The cell is written before its row is flagged, the tick never misses it
+        if (fb->frame[row][column] != data) {
+            fb->frame[row][column] = data;
+            fb->dirty_rows |= (uint8) (1U << row);
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType lcd_4bit_fb_send_string_pos(lcd_4bit_fb_t *fb, const uint8 *str, uint8 row, uint8 column) {
+    Std_ReturnType ret = E_OK;
+    uint8 changed = 0;
+
+    if (NULL == fb || NULL == str || row < ROW1 || row > CHR_LCD_FB_ROWS || column < 1 || column > CHR_LCD_FB_COLUMNS) {
+        ret = E_NOT_OK;
+    } else {
+        row--;
+        column--;
+        while (*str && column < CHR_LCD_FB_COLUMNS) {
+            if (fb->frame[row][column] != *str) {
+                fb->frame[row][column] = *str;
+                changed = 1;
+            }
+            str++;
+            column++;
+        }
+        if (changed) {
+            fb->dirty_rows |= (uint8) (1U << row);
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType lcd_4bit_fb_clear(lcd_4bit_fb_t *fb) {
+    Std_ReturnType ret = E_OK;
+    uint8 row = ZERO_INIT;
+
+    if (NULL == fb) {
+        ret = E_NOT_OK;
+    } else {
+        for (row = ROW1; row <= CHR_LCD_FB_ROWS; row++) {
+            ret = lcd_4bit_fb_send_string_pos(fb, (const uint8 *) "                    ", row, 1);
+        }
+    }
+    return ret;
+}
+
+void lcd_4bit_fb_tick(lcd_4bit_fb_t *fb) {
+    uint8 send = 0;
+
+    if (NULL == fb) {
+        /* Nothing */
+    } else if (LCD_FB_IDLE != fb->phase || E_OK == lcd_4bit_fb_next_cell(fb)) {
+        send = 1;
+    } else {
+        /* Nothing */
+    }
+#if CHR_LCD_RW_PIN==CONFIG_ENABLE
+    //A byte starts only once the previous one is done, busy ticks send nothing
+    if (send && (LCD_FB_CMD_HIGH == fb->phase || LCD_FB_DATA_HIGH == fb->phase)) {
+        uint8 busy = 1;
+        if (E_OK != lcd_4bit_read_busy(fb->lcd, &busy) || busy) {
+            send = 0;
+        }
+    }
+#endif
+    if (send) {
+        switch (fb->phase) {
+            case LCD_FB_CMD_HIGH:
+                (void) gpio_pin_write(&(fb->lcd->lcd_rs), GPIO_LOW);
+                (void) lcd_send_4bits(fb->lcd, fb->cmd >> FOUR_BIT_NUMBER);
+                fb->phase = LCD_FB_CMD_LOW;
+                break;
+            case LCD_FB_CMD_LOW:
+                (void) lcd_send_4bits(fb->lcd, fb->cmd);
+                fb->phase = LCD_FB_DATA_HIGH;
+                break;
+            case LCD_FB_DATA_HIGH:
+                (void) gpio_pin_write(&(fb->lcd->lcd_rs), GPIO_HIGH);
+                (void) lcd_send_4bits(fb->lcd, fb->data >> FOUR_BIT_NUMBER);
+                fb->phase = LCD_FB_DATA_LOW;
+                break;
+            default:
+                (void) lcd_send_4bits(fb->lcd, fb->data);
+                fb->phase = LCD_FB_IDLE;
+                break;
+        }
+        (void) lcd_4bits_send_enable_signal(fb->lcd);
+    }
+}
+#endif
+
 #elif defined(EIGHT_BIT_MODE)
 
 //==============================================================
 //                    8-Bit Mode Implementation
 //==============================================================
 
-Std_ReturnType lcd_8bit_init(const lcd_8bit_t *lcd) {
+Std_ReturnType lcd_8bit_init(lcd_8bit_t *lcd) {
     Std_ReturnType ret = E_OK;
     uint8 pins_counter = ZERO_INIT;
 
@@ -180,20 +354,27 @@ Std_ReturnType lcd_8bit_init(const lcd_8bit_t *lcd) {
         
         ret = gpio_pin_initialize(&(lcd->lcd_rs));
         ret = gpio_pin_initialize(&(lcd->lcd_en));
+#if CHR_LCD_RW_PIN==CONFIG_ENABLE
+        lcd->lcd_rw.direction = GPIO_DIRECTION_OUTPUT;
+        lcd->lcd_rw.logic = GPIO_LOW;
+        ret = gpio_pin_initialize(&(lcd->lcd_rw));
+#endif
         for (pins_counter = ZERO_INIT; pins_counter < EIGHT_BIT_NUMBER; pins_counter++) {
             lcd->lcd_data[pins_counter].direction = GPIO_DIRECTION_OUTPUT;
             lcd->lcd_data[pins_counter].logic = GPIO_LOW;
             gpio_pin_initialize(&(lcd->lcd_data[pins_counter]));
         }
+        ret = gpio_pin_group_init(&(lcd->lcd_data_group), lcd->lcd_data, EIGHT_BIT_NUMBER);
         __delay_ms(20);
-        ret = lcd_8bit_send_cmd(lcd, LCD_8BIT_MODE_2_LINES);
+        ret = lcd_8bit_send_init_cmd(lcd, LCD_8BIT_MODE_2_LINES);
         __delay_ms(5);
-        ret = lcd_8bit_send_cmd(lcd, LCD_8BIT_MODE_2_LINES);
+        ret = lcd_8bit_send_init_cmd(lcd, LCD_8BIT_MODE_2_LINES);
         __delay_us(120);
-        ret = lcd_8bit_send_cmd(lcd, LCD_8BIT_MODE_2_LINES);
+        ret = lcd_8bit_send_init_cmd(lcd, LCD_8BIT_MODE_2_LINES);
+
+        //The busy flag reads right from here on
 
         ret = lcd_8bit_send_cmd(lcd, LCD_CLEAR);
-        __delay_ms(1);
         ret = lcd_8bit_send_cmd(lcd, LCD_RETURN_HOME);
         ret = lcd_8bit_send_cmd(lcd, LCD_ENTRY_MODE);
         ret = lcd_8bit_send_cmd(lcd, LCD_CURSOR_OFF_DISPLAY_ON);
@@ -208,16 +389,14 @@ Std_ReturnType lcd_8bit_init(const lcd_8bit_t *lcd) {
 
 Std_ReturnType lcd_8bit_send_cmd(const lcd_8bit_t *lcd, uint8 cmd) {
     Std_ReturnType ret = E_OK;
-    uint8 pins_counter = ZERO_INIT;
 
     if (NULL == lcd) {
         ret = E_NOT_OK;
     } else {
         ret = gpio_pin_write(&(lcd->lcd_rs), GPIO_LOW);
-        for (pins_counter = ZERO_INIT; pins_counter < EIGHT_BIT_NUMBER; pins_counter++) {
-            gpio_pin_write(&(lcd->lcd_data[pins_counter]), (cmd >> pins_counter) & 0x01);
-        }
+        ret = gpio_pin_group_write(&(lcd->lcd_data_group), cmd);
         ret = lcd_8bits_send_enable_signal(lcd);
+        ret = lcd_8bit_wait_ready(lcd, LCD_IS_LONG_CMD(cmd));
     }
     return ret;
 }
@@ -228,16 +407,14 @@ Std_ReturnType lcd_8bit_send_cmd(const lcd_8bit_t *lcd, uint8 cmd) {
 
 Std_ReturnType lcd_8bit_send_char(const lcd_8bit_t *lcd, uint8 data) {
     Std_ReturnType ret = E_OK;
-    uint8 pins_counter = ZERO_INIT;
 
     if (NULL == lcd) {
         ret = E_NOT_OK;
     } else {
         ret = gpio_pin_write(&(lcd->lcd_rs), GPIO_HIGH);
-        for (pins_counter = ZERO_INIT; pins_counter < 8; pins_counter++) {
-            gpio_pin_write(&(lcd->lcd_data[pins_counter]), (data >> pins_counter) & 0x01);
-        }
+        ret = gpio_pin_group_write(&(lcd->lcd_data_group), data);
         ret = lcd_8bits_send_enable_signal(lcd);
+        ret = lcd_8bit_wait_ready(lcd, 0);
     }
     return ret;
 }
@@ -306,14 +483,12 @@ Std_ReturnType lcd_8bit_send_custom_char(const lcd_8bit_t *lcd, const uint8 chr[
 
 static Std_ReturnType lcd_send_4bits(const lcd_4bit_t *lcd, uint8 _data_cmd) {
     Std_ReturnType ret = E_OK;
-    uint8 l_pin_counter = ZERO_INIT;
 
     if (NULL == lcd) {
         ret = E_NOT_OK;
     } else {
-        for (l_pin_counter = ZERO_INIT; l_pin_counter < FOUR_BIT_NUMBER; l_pin_counter++) {
-            ret = gpio_pin_write(&(lcd->lcd_data[l_pin_counter]), (_data_cmd >> l_pin_counter) & 0x01);
-        }
+        //The low nibble, all four data lines change together
+        ret = gpio_pin_group_write(&(lcd->lcd_data_group), _data_cmd);
     }
     return ret;
 }
@@ -324,13 +499,161 @@ static Std_ReturnType lcd_4bits_send_enable_signal(const lcd_4bit_t *lcd) {
     if (NULL == lcd) {
         ret = E_NOT_OK;
     } else {
+#if defined(CHR_LCD_EN_PIN)
+        GPIO_FAST_PIN_HIGH(CHR_LCD_EN_PIN);
+        __delay_us(1);
+        GPIO_FAST_PIN_LOW(CHR_LCD_EN_PIN);
+#else
         ret = gpio_pin_write(&(lcd->lcd_en), GPIO_HIGH);
-        __delay_us(5);
+        __delay_us(1);
         ret = gpio_pin_write(&(lcd->lcd_en), GPIO_LOW);
+#endif
     }
     return ret;
 }
 
+#if CHR_LCD_FRAME_BUFFER==CONFIG_ENABLE
+/**
+ * @brief Finds the next cell where frame differs from shown and queues it.
+ * 
+ * Rows whose flag is clear are skipped, a row's flag is cleared as its scan
+ * starts, so a write landing during the scan flags it again. At most one
+ * row is scanned per call.
+ * @return E_OK when a cell was queued, E_NOT_OK when nothing is pending yet.
+ */
+static Std_ReturnType lcd_4bit_fb_next_cell(lcd_4bit_fb_t *fb) {
+    Std_ReturnType ret = E_OK;
+    uint8 row = fb->row;
+    uint8 column = fb->column;
+    uint8 rows_checked = ZERO_INIT;
+
+    if (0 == column) {
+        //Move to the next flagged row, or give up for this tick
+        while (E_OK == ret && 0 == (fb->dirty_rows & (1U << row))) {
+            if (++rows_checked >= CHR_LCD_FB_ROWS) {
+                ret = E_NOT_OK;
+            } else {
+                row = LCD_FB_NEXT_ROW(row);
+            }
+        }
+        if (E_OK == ret) {
+            fb->dirty_rows &= (uint8) ~(1U << row);
+        }
+    }
+    if (E_OK == ret) {
+        while (column < CHR_LCD_FB_COLUMNS && fb->frame[row][column] == fb->shown[row][column]) {
+            column++;
+        }
+        if (column >= CHR_LCD_FB_COLUMNS) {
+            fb->row = LCD_FB_NEXT_ROW(row);
+            fb->column = 0;
+            ret = E_NOT_OK;
+        }
+    }
+    if (E_OK == ret) {
+        fb->data = fb->frame[row][column];
+        fb->shown[row][column] = fb->data;
+        //The address counter steps by itself after each character, within a row
+        if (row == fb->cursor_row && column == fb->cursor_column) {
+            fb->phase = LCD_FB_DATA_HIGH;
+        } else {
+            fb->cmd = (uint8) (lcd_fb_row_start[row] + column);
+            fb->phase = LCD_FB_CMD_HIGH;
+        }
+        fb->cursor_row = row;
+        fb->cursor_column = (uint8) (column + 1U);
+
+        if (column + 1U >= CHR_LCD_FB_COLUMNS) {
+            fb->row = LCD_FB_NEXT_ROW(row);
+            fb->column = 0;
+        } else {
+            fb->row = row;
+            fb->column = (uint8) (column + 1U);
+        }
+    }
+    return ret;
+}
+#endif
+
+/**
+ * @brief Waits until the LCD can take the next byte: polls the busy flag when
+ *        the RW pin is wired, otherwise waits the worst case time.
+ * @param long_cmd Non zero after clear display or return home.
+ * @return E_NOT_OK if the busy flag never cleared.
+ */
+static Std_ReturnType lcd_4bit_wait_ready(const lcd_4bit_t *lcd, uint8 long_cmd) {
+    Std_ReturnType ret = E_OK;
+#if CHR_LCD_RW_PIN==CONFIG_ENABLE
+    uint8 busy = 1;
+    uint8 polls = ZERO_INIT;
+
+    (void) long_cmd;
+    for (polls = ZERO_INIT; (polls < CHR_LCD_BUSY_POLL_MAX) && (E_OK == ret) && busy; polls++) {
+        ret = lcd_4bit_read_busy(lcd, &busy);
+    }
+    if (busy) {
+        ret = E_NOT_OK;
+    }
+#else
+    (void) lcd;
+    if (long_cmd) {
+        __delay_ms(CHR_LCD_HOME_DELAY_MS);
+    } else {
+        __delay_us(CHR_LCD_EXEC_DELAY_US);
+    }
+#endif
+    return ret;
+}
+
+/**
+ * @brief Sends a command of the power-on sequence. The busy flag can't be read
+ *        until the LCD is in 4-bit mode, so this waits the worst case time.
+ */
+static Std_ReturnType lcd_4bit_send_init_cmd(const lcd_4bit_t *lcd, uint8 cmd) {
+    Std_ReturnType ret = E_OK;
+
+    ret = gpio_pin_write(&(lcd->lcd_rs), GPIO_LOW);
+    ret = lcd_send_4bits(lcd, cmd >> FOUR_BIT_NUMBER);
+    ret = lcd_4bits_send_enable_signal(lcd);
+    ret = lcd_send_4bits(lcd, cmd);
+    ret = lcd_4bits_send_enable_signal(lcd);
+    if (LCD_IS_LONG_CMD(cmd)) {
+        __delay_ms(CHR_LCD_HOME_DELAY_MS);
+    } else {
+        __delay_us(CHR_LCD_EXEC_DELAY_US);
+    }
+    return ret;
+}
+
+#if CHR_LCD_RW_PIN==CONFIG_ENABLE
+/**
+ * @brief Reads the busy flag, D7 of the high nibble. The low nibble is clocked
+ *        out too so the next read or write starts on a byte boundary.
+ */
+static Std_ReturnType lcd_4bit_read_busy(const lcd_4bit_t *lcd, uint8 *busy) {
+    Std_ReturnType ret = E_OK;
+    uint8 high_nibble = ZERO_INIT;
+
+    //Data lines released before RW lets the LCD drive them
+    ret = gpio_pin_group_set_direction(&(lcd->lcd_data_group), GPIO_DIRECTION_INPUT);
+    ret = gpio_pin_write(&(lcd->lcd_rs), GPIO_LOW);
+    ret = gpio_pin_write(&(lcd->lcd_rw), GPIO_HIGH);
+
+    ret = gpio_pin_write(&(lcd->lcd_en), GPIO_HIGH);
+    __delay_us(1);
+    ret = gpio_pin_group_read(&(lcd->lcd_data_group), &high_nibble);
+    ret = gpio_pin_write(&(lcd->lcd_en), GPIO_LOW);
+    ret = gpio_pin_write(&(lcd->lcd_en), GPIO_HIGH);
+    __delay_us(1);
+    ret = gpio_pin_write(&(lcd->lcd_en), GPIO_LOW);
+
+    ret = gpio_pin_write(&(lcd->lcd_rw), GPIO_LOW);
+    ret = gpio_pin_group_set_direction(&(lcd->lcd_data_group), GPIO_DIRECTION_OUTPUT);
+    *busy = (high_nibble & (LCD_BUSY_FLAG >> FOUR_BIT_NUMBER)) ? 1 : 0;
+    return ret;
+}
+#endif
+
 static Std_ReturnType lcd_4bit_set_cursor(const lcd_4bit_t *lcd, uint8 row, uint8 column) {
     Std_ReturnType ret = E_OK;
     column--;
@@ -367,13 +690,92 @@ static Std_ReturnType lcd_8bits_send_enable_signal(const lcd_8bit_t *lcd) {
     if (NULL == lcd) {
         ret = E_NOT_OK;
     } else {
+#if defined(CHR_LCD_EN_PIN)
+        GPIO_FAST_PIN_HIGH(CHR_LCD_EN_PIN);
+        __delay_us(1);
+        GPIO_FAST_PIN_LOW(CHR_LCD_EN_PIN);
+#else
         ret = gpio_pin_write(&(lcd->lcd_en), GPIO_HIGH);
-        __delay_us(5);
+        __delay_us(1);
         ret = gpio_pin_write(&(lcd->lcd_en), GPIO_LOW);
+#endif
     }
     return ret;
 }
 
+/**
+ * @brief Waits until the LCD can take the next byte: polls the busy flag when
+ *        the RW pin is wired, otherwise waits the worst case time.
+ * @param long_cmd Non zero after clear display or return home.
+ * @return E_NOT_OK if the busy flag never cleared.
+ */
+static Std_ReturnType lcd_8bit_wait_ready(const lcd_8bit_t *lcd, uint8 long_cmd) {
+    Std_ReturnType ret = E_OK;
+#if CHR_LCD_RW_PIN==CONFIG_ENABLE
+    uint8 busy = 1;
+    uint8 polls = ZERO_INIT;
+
+    (void) long_cmd;
+    for (polls = ZERO_INIT; (polls < CHR_LCD_BUSY_POLL_MAX) && (E_OK == ret) && busy; polls++) {
+        ret = lcd_8bit_read_busy(lcd, &busy);
+    }
+    if (busy) {
+        ret = E_NOT_OK;
+    }
+#else
+    (void) lcd;
+    if (long_cmd) {
+        __delay_ms(CHR_LCD_HOME_DELAY_MS);
+    } else {
+        __delay_us(CHR_LCD_EXEC_DELAY_US);
+    }
+#endif
+    return ret;
+}
+
+/**
+ * @brief Sends a function set of the power-on sequence. The busy flag can't be
+ *        read before it, so this waits the worst case time.
+ */
+static Std_ReturnType lcd_8bit_send_init_cmd(const lcd_8bit_t *lcd, uint8 cmd) {
+    Std_ReturnType ret = E_OK;
+
+    ret = gpio_pin_write(&(lcd->lcd_rs), GPIO_LOW);
+    ret = gpio_pin_group_write(&(lcd->lcd_data_group), cmd);
+    ret = lcd_8bits_send_enable_signal(lcd);
+    if (LCD_IS_LONG_CMD(cmd)) {
+        __delay_ms(CHR_LCD_HOME_DELAY_MS);
+    } else {
+        __delay_us(CHR_LCD_EXEC_DELAY_US);
+    }
+    return ret;
+}
+
+#if CHR_LCD_RW_PIN==CONFIG_ENABLE
+/**
+ * @brief Reads the busy flag, D7 of the status byte.
+ */
+static Std_ReturnType lcd_8bit_read_busy(const lcd_8bit_t *lcd, uint8 *busy) {
+    Std_ReturnType ret = E_OK;
+    uint8 status = ZERO_INIT;
+
+    //Data lines released before RW lets the LCD drive them
+    ret = gpio_pin_group_set_direction(&(lcd->lcd_data_group), GPIO_DIRECTION_INPUT);
+    ret = gpio_pin_write(&(lcd->lcd_rs), GPIO_LOW);
+    ret = gpio_pin_write(&(lcd->lcd_rw), GPIO_HIGH);
+
+    ret = gpio_pin_write(&(lcd->lcd_en), GPIO_HIGH);
+    __delay_us(1);
+    ret = gpio_pin_group_read(&(lcd->lcd_data_group), &status);
+    ret = gpio_pin_write(&(lcd->lcd_en), GPIO_LOW);
+
+    ret = gpio_pin_write(&(lcd->lcd_rw), GPIO_LOW);
+    ret = gpio_pin_group_set_direction(&(lcd->lcd_data_group), GPIO_DIRECTION_OUTPUT);
+    *busy = (status & LCD_BUSY_FLAG) ? 1 : 0;
+    return ret;
+}
+#endif
+
 static Std_ReturnType lcd_8bit_set_cursor(const lcd_8bit_t *lcd, uint8 row, uint8 column) {
     Std_ReturnType ret = E_OK;
     column--;
@@ -404,41 +806,32 @@ static Std_ReturnType lcd_8bit_set_cursor(const lcd_8bit_t *lcd, uint8 row, uint
 
 #endif
 
+/**
+ * @brief Converts an 8-bit integer to a string.
+ * @param value 8-bit integer value.
+ * @param str Pointer to the string buffer, at least NUM_CONV_UINT8_SIZE bytes.
+ * @return Status of the operation.
+ */
 Std_ReturnType convert_uint8_to_string(uint8 value, uint8 *str){
-    Std_ReturnType ret = E_OK;
-
-    if (NULL == str) {
-        ret = E_NOT_OK;
-    } else {
-        memset(str,0,4);
-        sprintf(str,"%d",value);
-    }
-    
-    return ret;
+    return Num_Conv_Uint8_To_String(value, str);
 }
 
+/**
+ * @brief Converts a 16-bit integer to a string.
+ * @param value 16-bit integer value.
+ * @param str Pointer to the string buffer, at least NUM_CONV_UINT16_SIZE bytes.
+ * @return Status of the operation.
+ */
 Std_ReturnType convert_uint16_to_string(uint16 value, uint8 *str){
-    Std_ReturnType ret = E_OK;
-
-    if (NULL == str) {
-        ret = E_NOT_OK;
-    } else {
-        memset(str,0,6);
-        sprintf(str,"%d",value);
-    }
-    
-    return ret;
+    return Num_Conv_Uint16_To_String(value, str);
 }
 
-Std_ReturnType convert_uint32_to_string(uint32 value, uint16 *str){
-    Std_ReturnType ret = E_OK;
-
-    if (NULL == str) {
-        ret = E_NOT_OK;
-    } else {
-        memset(str,0,11);
-        sprintf(str,"%d",value);
-    }
-    
-    return ret;
+/**
+ * @brief Converts a 32-bit integer to a string.
+ * @param value 32-bit integer value.
+ * @param str Pointer to the string buffer, at least NUM_CONV_UINT32_SIZE bytes.
+ * @return Status of the operation.
+ */
+Std_ReturnType convert_uint32_to_string(uint32 value, uint8 *str){
+    return Num_Conv_Uint32_To_String(value, str);
 }
@@ -14,6 +14,7 @@
 //===================================
 #include "chr_lcd_cfg.h"
 #include "../../MCAL_Layer/GPIO/gpio.h"
+#include "../../Utilities/Num_Conv/num_conv.h"
 
 //===================================
 // Macro Declarations
@@ -45,6 +46,14 @@
 #define FOUR_BIT_NUMBER                      4
 #define EIGHT_BIT_NUMBER                     8
 
+#define LCD_BUSY_FLAG                        0x80
+
+#if defined(FOUR_BIT_MODE) && CHR_LCD_FRAME_BUFFER==CONFIG_ENABLE
+#if (CHR_LCD_FB_ROWS < 1) || (CHR_LCD_FB_ROWS > 4) || (CHR_LCD_FB_COLUMNS < 1) || (CHR_LCD_FB_COLUMNS > 20)
+#error "CHR_LCD_FB_ROWS must be 1 to 4 and CHR_LCD_FB_COLUMNS 1 to 20"
+#endif
+#endif
+
 //===================================
 // Data Types Declarations
 //===================================
@@ -53,14 +62,43 @@ typedef struct
 {
     pin_config_t lcd_rs;
     pin_config_t lcd_en;
+#if CHR_LCD_RW_PIN==CONFIG_ENABLE
+    pin_config_t lcd_rw;
+#endif
     pin_config_t lcd_data[4];
+    gpio_pin_group_t lcd_data_group;    // Filled by lcd_4bit_init from lcd_data
 } lcd_4bit_t;
+
+#if CHR_LCD_FRAME_BUFFER==CONFIG_ENABLE
+/*
+ * Shadow of the display. Writers change frame and flag the row, the tick sends
+ * every cell where frame differs from shown and then updates shown.
+ */
+typedef struct
+{
+    const lcd_4bit_t *lcd;
+    volatile uint8 frame[CHR_LCD_FB_ROWS][CHR_LCD_FB_COLUMNS];  // Wanted content
+    uint8 shown[CHR_LCD_FB_ROWS][CHR_LCD_FB_COLUMNS];           // Content sent to the LCD
+    volatile uint8 dirty_rows;                                  // Bit r: row r may differ
+    uint8 row;                                                  // Scan position of the tick
+    uint8 column;
+    uint8 cursor_row;                                           // LCD address counter, row 0xFF if unknown
+    uint8 cursor_column;
+    uint8 phase;                                                // Next nibble to send
+    uint8 cmd;                                                  // Set DDRAM address of the pending cell
+    uint8 data;                                                 // Character of the pending cell
+} lcd_4bit_fb_t;
+#endif
 #elif defined(EIGHT_BIT_MODE)
 typedef struct
 {
     pin_config_t lcd_rs;
     pin_config_t lcd_en;
+#if CHR_LCD_RW_PIN==CONFIG_ENABLE
+    pin_config_t lcd_rw;
+#endif
     pin_config_t lcd_data[8];
+    gpio_pin_group_t lcd_data_group;    // Filled by lcd_8bit_init from lcd_data
 } lcd_8bit_t;
 #endif
 
@@ -131,6 +169,59 @@ Std_ReturnType lcd_4bit_send_string_pos(const lcd_4bit_t *lcd, uint8 *str, uint8
  */
 Std_ReturnType lcd_4bit_send_custom_char(const lcd_4bit_t *lcd, const uint8 chr[], 
                                         uint8 row, uint8 column, uint8 mem_pos);
+
+#if CHR_LCD_FRAME_BUFFER==CONFIG_ENABLE
+/**
+ * @brief Binds a frame buffer to an initialized 4-bit LCD, all cells blank.
+ * 
+ * From here on only the tick may talk to that LCD, the blocking lcd_4bit_*
+ * functions must not be used on it.
+ * @param fb Pointer to the frame buffer.
+ * @param lcd Pointer to the LCD, already set up by lcd_4bit_init.
+ * @return Status of the operation.
+ */
+Std_ReturnType lcd_4bit_fb_init(lcd_4bit_fb_t *fb, const lcd_4bit_t *lcd);
+
+/**
+ * @brief Writes a character to the frame buffer and returns at once.
+ * @param fb Pointer to the frame buffer.
+ * @param data Character to be shown.
+ * @param row Row number, 1 to CHR_LCD_FB_ROWS.
+ * @param column Column number, 1 to CHR_LCD_FB_COLUMNS.
+ * @return Status of the operation.
+ */
+Std_ReturnType lcd_4bit_fb_send_char_pos(lcd_4bit_fb_t *fb, uint8 data, uint8 row, uint8 column);
+
+/**
+ * @brief Writes a string to the frame buffer and returns at once.
+ *        Characters past the end of the row are dropped.
+ * @param fb Pointer to the frame buffer.
+ * @param str String to be shown.
+ * @param row Row number, 1 to CHR_LCD_FB_ROWS.
+ * @param column Column number, 1 to CHR_LCD_FB_COLUMNS.
+ * @return Status of the operation.
+ */
+Std_ReturnType lcd_4bit_fb_send_string_pos(lcd_4bit_fb_t *fb, const uint8 *str, uint8 row, uint8 column);
+
+/**
+ * @brief Blanks the whole frame buffer.
+ * @param fb Pointer to the frame buffer.
+ * @return Status of the operation.
+ */
+Std_ReturnType lcd_4bit_fb_clear(lcd_4bit_fb_t *fb);
+
+/**
+ * @brief Sends at most one nibble of the next changed cell, meant for a timer ISR.
+ * 
+ * A cell costs 2 ticks when it follows the previous one on its row, 4 when the
+ * address has to be set first. The LCD needs ~40 us after the second nibble of
+ * a byte, so the tick period must be at least that, 100 us or more is typical.
+ * With CHR_LCD_RW_PIN a tick that finds the LCD busy sends nothing, so any
+ * period works.
+ * @param fb Pointer to the frame buffer.
+ */
+void lcd_4bit_fb_tick(lcd_4bit_fb_t *fb);
+#endif
 #elif defined(EIGHT_BIT_MODE)
 Std_ReturnType lcd_8bit_init(lcd_8bit_t *lcd);
 Std_ReturnType lcd_8bit_send_cmd(const lcd_8bit_t *lcd, uint8 cmd);
@@ -145,7 +236,7 @@ Std_ReturnType lcd_8bit_send_custom_char(const lcd_8bit_t *lcd, uint8 const chr[
 /**
  * @brief Converts an 8-bit integer to a string.
  * @param value 8-bit integer value.
- * @param str Pointer to the string buffer.
+ * @param str Pointer to the string buffer, at least NUM_CONV_UINT8_SIZE bytes.
  * @return Status of the operation.
  */
 Std_ReturnType convert_uint8_to_string(uint8 value, uint8 *str);
@@ -153,7 +244,7 @@ Std_ReturnType convert_uint8_to_string(uint8 value, uint8 *str);
 /**
  * @brief Converts a 16-bit integer to a string.
  * @param value 16-bit integer value.
- * @param str Pointer to the string buffer.
+ * @param str Pointer to the string buffer, at least NUM_CONV_UINT16_SIZE bytes.
  * @return Status of the operation.
  */
 Std_ReturnType convert_uint16_to_string(uint16 value, uint8 *str);
@@ -161,9 +252,9 @@ Std_ReturnType convert_uint16_to_string(uint16 value, uint8 *str);
 /**
  * @brief Converts a 32-bit integer to a string.
  * @param value 32-bit integer value.
- * @param str Pointer to the string buffer.
+ * @param str Pointer to the string buffer, at least NUM_CONV_UINT32_SIZE bytes.
  * @return Status of the operation.
  */
-Std_ReturnType convert_uint32_to_string(uint32 value, uint16 *str);
+Std_ReturnType convert_uint32_to_string(uint32 value, uint8 *str);
 
 #endif /* CHR_LCD_H */
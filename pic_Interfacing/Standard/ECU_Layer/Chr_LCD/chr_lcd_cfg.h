@@ -17,6 +17,25 @@
 //===================================
 #define FOUR_BIT_MODE
 
+/* Optional build time binding of the EN pin, GPIO_PIN_ID(port letter, pin number).
+ * The enable pulse then toggles it with single bit instructions instead of
+ * gpio_pin_write. It must be the same pin as lcd_en of every LCD instance. */
+//#define CHR_LCD_EN_PIN          GPIO_PIN_ID(C, 2)
+
+/* With the RW pin wired the driver polls the busy flag after every byte instead
+ * of waiting the worst case, lcd_rw must then be set in the LCD structure. */
+#define CHR_LCD_RW_PIN          CONFIG_DISABLE
+/* Busy flag reads before a byte is reported as failed, one read is a few us */
+#define CHR_LCD_BUSY_POLL_MAX   250
+/* Fixed waits without the RW pin: most instructions, then clear and home */
+#define CHR_LCD_EXEC_DELAY_US   50
+#define CHR_LCD_HOME_DELAY_MS   2
+
+/* Frame buffer driven 4-bit LCD, refreshed one nibble per lcd_4bit_fb_tick() */
+#define CHR_LCD_FRAME_BUFFER    CONFIG_ENABLE
+#define CHR_LCD_FB_ROWS         2
+#define CHR_LCD_FB_COLUMNS      16
+
 //===================================
 // Macro Functions Declarations
 //===================================
@@ -0,0 +1,306 @@
+/* 
+ * File:   eeprom_log.c
+ * Author: Salah-Eldin
+ * Description:
+ * This implementation file provides the wear-leveled record log on the data EEPROM.
+ * The next record always goes to the slot after the newest one, wrapping at the end
+ * of the log area, so a slot is only rewritten once every EEPROM_LOG_SLOTS records.
+ * Created on October 17, 2026
+ */
+
+//========================================================================== 
+//                           Includes                             
+//==========================================================================
+
+#include "eeprom_log.h"
+
+#if EEPROM_INTERRUPT_ENABLE_FEATURE!=INTERRUPT_FEATURE_ENABLE
+#error "The EEPROM log is written from EEPROM_ISR, enable EEPROM_INTERRUPT_ENABLE_FEATURE"
+#endif
+
+//========================================================================== 
+//                           Macro Declarations                            
+//========================================================================== 
+#define EEPROM_LOG_SEQ_LOW_INDEX    0U
+#define EEPROM_LOG_SEQ_HIGH_INDEX   1U
+#define EEPROM_LOG_PAYLOAD_INDEX    2U
+#define EEPROM_LOG_CHECK_INDEX      (EEPROM_LOG_RECORD_SIZE - 1U)
+
+//========================================================================== 
+//                           Static Variables                            
+//========================================================================== 
+static uint8 eeprom_log_record[EEPROM_LOG_RECORD_SIZE];
+static volatile uint8 eeprom_log_busy = 0;
+static uint16 eeprom_log_head = 0;          /* slot the next record goes to   */
+static uint16 eeprom_log_sequence = 0;      /* sequence number of that record */
+static uint16 eeprom_log_count = 0;
+static void (*eeprom_log_append_done)(void) = NULL;
+
+static uint16 eeprom_log_slot_address(uint16 slot);
+static uint8 eeprom_log_check(const uint8 *record);
+static uint16 eeprom_log_record_sequence(const uint8 *record);
+static Std_ReturnType eeprom_log_read_slot(uint16 slot, uint8 *record);
+static void eeprom_log_write_complete(void);
+
+//========================================================================== 
+//                           Function Definitions                            
+//========================================================================== 
+
+/**
+ * @brief Scans the log area and resumes after the newest valid record.
+ * 
+ * Records whose check byte does not match, such as one torn by a reset in the
+ * middle of its write, are ignored. Call it once at boot before any append.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An EEPROM write is in progress.
+ */
+Std_ReturnType eeprom_log_init(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 record[EEPROM_LOG_RECORD_SIZE];
+    uint16 newest_slot = 0;
+    uint16 newest_sequence = 0;
+    uint8 found = 0;
+
+    if(eeprom_log_busy)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* All valid sequence numbers lie within EEPROM_LOG_SLOTS of each other,
+           so the wrap-aware comparison picks the newest even after 0xFFFF */
+        for(uint16 slot = 0; slot < EEPROM_LOG_SLOTS; slot++)
+        {
+            if(E_OK == eeprom_log_read_slot(slot, record))
+            {
+                uint16 sequence = eeprom_log_record_sequence(record);
+                if((0 == found) || ((sint16)(sequence - newest_sequence) > 0))
+                {
+                    newest_slot = slot;
+                    newest_sequence = sequence;
+                    found = 1;
+                }
+            }
+        }
+
+        eeprom_log_count = 0;
+        if(found)
+        {
+            eeprom_log_head = (uint16)((newest_slot + 1U) % EEPROM_LOG_SLOTS);
+            eeprom_log_sequence = (uint16)(newest_sequence + 1U);
+
+            /* Readable history is the unbroken chain walking back from the newest */
+            uint16 slot = newest_slot;
+            do
+            {
+                if((E_OK != eeprom_log_read_slot(slot, record)) ||
+                   (eeprom_log_record_sequence(record) != (uint16)(newest_sequence - eeprom_log_count)))
+                {
+                    break;
+                }
+                eeprom_log_count++;
+                slot = (0 == slot) ? (uint16)(EEPROM_LOG_SLOTS - 1U) : (uint16)(slot - 1U);
+            } while(eeprom_log_count < EEPROM_LOG_SLOTS);
+        }
+        else
+        {
+            eeprom_log_head = 0;
+            eeprom_log_sequence = 0;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Queues one record and starts writing it in the background.
+ * 
+ * The payload is copied, so the caller's buffer is free on return. One byte is
+ * written per EEPROM write complete interrupt, the record becomes readable once
+ * its last byte is written.
+ * 
+ * @param payload EEPROM_LOG_PAYLOAD_SIZE bytes to store.
+ * @param append_done Called from the EEPROM interrupt when the record is written, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL payload, or the previous record is still being written.
+ */
+Std_ReturnType eeprom_log_append(const uint8 *payload, void (*append_done)(void))
+{
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == payload) || eeprom_log_busy)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        eeprom_log_record[EEPROM_LOG_SEQ_LOW_INDEX] = (uint8)(eeprom_log_sequence & 0xFF);
+        eeprom_log_record[EEPROM_LOG_SEQ_HIGH_INDEX] = (uint8)(eeprom_log_sequence >> 8);
+        for(uint8 index = 0; index < EEPROM_LOG_PAYLOAD_SIZE; index++)
+        {
+            eeprom_log_record[EEPROM_LOG_PAYLOAD_INDEX + index] = payload[index];
+        }
+        eeprom_log_record[EEPROM_LOG_CHECK_INDEX] = eeprom_log_check(eeprom_log_record);
+
+        eeprom_log_append_done = append_done;
+        eeprom_log_busy = 1;
+        /* Bytes go out in address order, so the check byte is programmed last */
+        ret = EEPROM_WriteBuffer_Async(eeprom_log_slot_address(eeprom_log_head), eeprom_log_record,
+                                       EEPROM_LOG_RECORD_SIZE, eeprom_log_write_complete);
+        if(E_OK != ret)
+        {
+            eeprom_log_busy = 0;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads back a record by age.
+ * 
+ * @param age 0 for the newest record, 1 for the one before it and so on.
+ * @param payload A pointer to store EEPROM_LOG_PAYLOAD_SIZE bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: No such record, it is corrupted, or a write is in progress.
+ */
+Std_ReturnType eeprom_log_read(uint16 age, uint8 *payload)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 record[EEPROM_LOG_RECORD_SIZE];
+
+    if((NULL == payload) || eeprom_log_busy || (age >= eeprom_log_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        uint16 slot = (uint16)((eeprom_log_head + EEPROM_LOG_SLOTS - 1U - age) % EEPROM_LOG_SLOTS);
+
+        ret = eeprom_log_read_slot(slot, record);
+        if((E_OK == ret) &&
+           (eeprom_log_record_sequence(record) == (uint16)(eeprom_log_sequence - 1U - age)))
+        {
+            for(uint8 index = 0; index < EEPROM_LOG_PAYLOAD_SIZE; index++)
+            {
+                payload[index] = record[EEPROM_LOG_PAYLOAD_INDEX + index];
+            }
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the number of records that can be read back.
+ * 
+ * @param count A pointer to store the number of records, at most EEPROM_LOG_SLOTS.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType eeprom_log_get_count(uint16 *count)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == count)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *count = eeprom_log_count;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reports whether a record is still being written.
+ * 
+ * @param busy A pointer to store 1 while a record is being written, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType eeprom_log_is_busy(uint8 *busy)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == busy)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *busy = eeprom_log_busy;
+    }
+    return ret;
+}
+
+//========================================================================== 
+//                           Helper Functions                            
+//========================================================================== 
+
+static uint16 eeprom_log_slot_address(uint16 slot)
+{
+    return (uint16)(EEPROM_LOG_START_ADDRESS + (slot * EEPROM_LOG_RECORD_SIZE));
+}
+
+static uint8 eeprom_log_check(const uint8 *record)
+{
+    uint8 sum = 0;
+
+    for(uint8 index = 0; index < EEPROM_LOG_CHECK_INDEX; index++)
+    {
+        sum += record[index];
+    }
+    /* Inverted so an erased (all 0xFF) slot never checks out */
+    return (uint8)~sum;
+}
+
+static uint16 eeprom_log_record_sequence(const uint8 *record)
+{
+    return (uint16)(record[EEPROM_LOG_SEQ_LOW_INDEX] | ((uint16)record[EEPROM_LOG_SEQ_HIGH_INDEX] << 8));
+}
+
+static Std_ReturnType eeprom_log_read_slot(uint16 slot, uint8 *record)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 address = eeprom_log_slot_address(slot);
+
+    for(uint8 index = 0; (index < EEPROM_LOG_RECORD_SIZE) && (E_OK == ret); index++)
+    {
+        ret = EEPROM_ReadByte((uint16)(address + index), &record[index]);
+    }
+    if((E_OK == ret) && (record[EEPROM_LOG_CHECK_INDEX] != eeprom_log_check(record)))
+    {
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief EEPROM write complete handler, runs from EEPROM_ISR once the whole
+ *        record is programmed and publishes it.
+ */
+static void eeprom_log_write_complete(void)
+{
+    eeprom_log_head = (uint16)((eeprom_log_head + 1U) % EEPROM_LOG_SLOTS);
+    eeprom_log_sequence++;
+    if(eeprom_log_count < EEPROM_LOG_SLOTS)
+    {
+        eeprom_log_count++;
+    }
+    eeprom_log_busy = 0;
+
+    if(eeprom_log_append_done)
+    {
+        eeprom_log_append_done();
+    }
+}
@@ -0,0 +1,97 @@
+/* 
+ * File:   eeprom_log.h
+ * Author: Salah-Eldin
+ * Description:
+ * This header file provides an append-only record log on the internal data EEPROM.
+ * Records rotate through the whole log area so every cell wears at the same rate,
+ * and they are written in the background from the EEPROM write complete interrupt.
+ * Created on October 17, 2026
+ */
+
+#ifndef EEPROM_LOG_H
+#define	EEPROM_LOG_H
+
+/* ========================================================================== */
+/*                           Includes                                          */
+/* ========================================================================== */
+#include "../../MCAL_Layer/EEPROM/eeprom.h"
+#include "eeprom_log_cfg.h"
+
+/* ========================================================================== */
+/*                           Macro Declarations                                */
+/* ========================================================================== */
+/* Record layout: sequence number (low, high), payload, check byte */
+#define EEPROM_LOG_PAYLOAD_SIZE     (EEPROM_LOG_RECORD_SIZE - 3U)
+#define EEPROM_LOG_SLOTS            (EEPROM_LOG_AREA_SIZE / EEPROM_LOG_RECORD_SIZE)
+
+/* ========================================================================== */
+/*                     Macro Functions Declarations                            */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                           Data Types Declarations                           */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                         Functions Declarations                              */
+/* ========================================================================== */
+
+/**
+ * @brief Scans the log area and resumes after the newest valid record.
+ * 
+ * Records whose check byte does not match, such as one torn by a reset in the
+ * middle of its write, are ignored. Call it once at boot before any append.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An EEPROM write is in progress.
+ */
+Std_ReturnType eeprom_log_init(void);
+
+/**
+ * @brief Queues one record and starts writing it in the background.
+ * 
+ * The payload is copied, so the caller's buffer is free on return. One byte is
+ * written per EEPROM write complete interrupt, the record becomes readable once
+ * its last byte is written.
+ * 
+ * @param payload EEPROM_LOG_PAYLOAD_SIZE bytes to store.
+ * @param append_done Called from the EEPROM interrupt when the record is written, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL payload, or the previous record is still being written.
+ */
+Std_ReturnType eeprom_log_append(const uint8 *payload, void (*append_done)(void));
+
+/**
+ * @brief Reads back a record by age.
+ * 
+ * @param age 0 for the newest record, 1 for the one before it and so on.
+ * @param payload A pointer to store EEPROM_LOG_PAYLOAD_SIZE bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: No such record, it is corrupted, or a write is in progress.
+ */
+Std_ReturnType eeprom_log_read(uint16 age, uint8 *payload);
+
+/**
+ * @brief Gets the number of records that can be read back.
+ * 
+ * @param count A pointer to store the number of records, at most EEPROM_LOG_SLOTS.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType eeprom_log_get_count(uint16 *count);
+
+/**
+ * @brief Reports whether a record is still being written.
+ * 
+ * @param busy A pointer to store 1 while a record is being written, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType eeprom_log_is_busy(uint8 *busy);
+
+#endif	/* EEPROM_LOG_H */
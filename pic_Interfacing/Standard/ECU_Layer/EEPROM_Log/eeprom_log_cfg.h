@@ -0,0 +1,45 @@
+/* 
+ * File:   eeprom_log_cfg.h
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef EEPROM_LOG_CFG_H
+#define	EEPROM_LOG_CFG_H
+
+/* ========================================================================== */
+/*                           Includes                                          */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                           Macro Declarations                                */
+/* ========================================================================== */
+/* Part of the data EEPROM the log rotates through, the PIC18F4620 has 1024 bytes */
+#define EEPROM_LOG_START_ADDRESS    0x000U
+#define EEPROM_LOG_AREA_SIZE        1024U
+
+/* Bytes per record including the 2-byte sequence number and the check byte */
+#define EEPROM_LOG_RECORD_SIZE      16U
+
+#if (EEPROM_LOG_RECORD_SIZE < 4U) || (EEPROM_LOG_AREA_SIZE % EEPROM_LOG_RECORD_SIZE)
+#error "EEPROM_LOG_AREA_SIZE must hold a whole number of records of at least 4 bytes"
+#endif
+
+#if (EEPROM_LOG_START_ADDRESS + EEPROM_LOG_AREA_SIZE) > 1024U
+#error "The EEPROM log area does not fit in the data EEPROM"
+#endif
+
+/* ========================================================================== */
+/*                     Macro Functions Declarations                            */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                           Data Types Declarations                           */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                         Functions Declarations                              */
+/* ========================================================================== */
+
+#endif	/* EEPROM_LOG_CFG_H */
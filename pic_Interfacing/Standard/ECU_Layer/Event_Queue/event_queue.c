@@ -0,0 +1,88 @@
+/* 
+ * File:   event_queue.c
+ * Author: Salah-Eldin
+ *
+ * Description: This file contains the implementation of the event ring shared by the input drivers.
+ *
+ * Created on October 17, 2026
+ */
+
+//=========================================================================
+//                            Includes
+//=========================================================================
+#include "event_queue.h"
+
+//=========================================================================
+//                           Functions Implementation
+//=========================================================================
+
+/**
+ * @brief Empties a queue and attaches its storage.
+ *
+ * @param queue A pointer to the queue.
+ * @param events The storage, it must stay valid while the queue is used.
+ * @param size Number of events in the storage, a power of two up to EVENT_QUEUE_MAX_SIZE.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A NULL pointer, or a size that is not a power of two.
+ */
+Std_ReturnType event_queue_init(event_queue_t *queue, event_queue_event_t *events, uint8 size) {
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == queue || NULL == events || 0 == size || size > EVENT_QUEUE_MAX_SIZE || (size & (size - 1U))) {
+        ret = E_NOT_OK;
+    } else {
+        queue->events = events;
+        queue->mask = (uint8) (size - 1U);
+        queue->head = 0;
+        queue->tail = 0;
+        queue->dropped = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief Queues an event, it is dropped and counted if the queue is full.
+ *
+ * @param queue A pointer to an initialized queue.
+ * @param source The key or button the event is about.
+ * @param type The event type.
+ */
+void event_queue_push(event_queue_t *queue, uint8 source, uint8 type) {
+    uint8 head = queue->head;
+
+    if ((uint8) (head - queue->tail) > queue->mask) {
+        if (queue->dropped < 0xFFU) {
+            queue->dropped++;
+        }
+    } else {
+        queue->events[head & queue->mask].source = source;
+        queue->events[head & queue->mask].type = type;
+        //Published after the event is written so the consumer never sees half of it
+        queue->head = (uint8) (head + 1U);
+    }
+}
+
+/**
+ * @brief Takes the oldest event.
+ *
+ * @param queue A pointer to an initialized queue.
+ * @param event A pointer to store the event.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: An event was taken.
+ *         - E_NOT_OK: The queue is empty, or a NULL pointer.
+ */
+Std_ReturnType event_queue_pop(event_queue_t *queue, event_queue_event_t *event) {
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == queue || NULL == event || queue->tail == queue->head) {
+        ret = E_NOT_OK;
+    } else {
+        uint8 tail = queue->tail;
+
+        *event = queue->events[tail & queue->mask];
+        //Published after the copy so the producer never overwrites what is being read
+        queue->tail = (uint8) (tail + 1U);
+    }
+    return ret;
+}
@@ -0,0 +1,79 @@
+/* 
+ * File:   event_queue.h
+ * Author: Salah-Eldin
+ *
+ * Description:
+ * This header file provides the single producer, single consumer event ring shared
+ * by the input drivers. The producer is a periodic tick, the consumer the main loop.
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef EVENT_QUEUE_H
+#define	EVENT_QUEUE_H
+
+//=========================================================================
+//                              Includes
+//=========================================================================
+#include "../../MCAL_Layer/std_types.h"
+
+//=========================================================================
+//                           Macro Declarations
+//=========================================================================
+/* The free running head and tail are 8 bits, the ring must be smaller than that */
+#define EVENT_QUEUE_MAX_SIZE        128U
+
+//=========================================================================
+//                           Data Types Declarations
+//=========================================================================
+
+typedef struct {
+    uint8 source;   // Key or button the event is about
+    uint8 type;     // Event type of the driver that owns the queue
+} event_queue_event_t;
+
+typedef struct {
+    event_queue_event_t *events;    // Storage given to event_queue_init
+    uint8 mask;                     // Storage size - 1
+    volatile uint8 head;            // Written by event_queue_push only
+    volatile uint8 tail;            // Written by event_queue_pop only
+    volatile uint8 dropped;         // Events lost to a full queue, saturates
+} event_queue_t;
+
+//=========================================================================
+//                           Functions Declarations
+//=========================================================================
+
+/**
+ * @brief Empties a queue and attaches its storage.
+ *
+ * @param queue A pointer to the queue.
+ * @param events The storage, it must stay valid while the queue is used.
+ * @param size Number of events in the storage, a power of two up to EVENT_QUEUE_MAX_SIZE.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A NULL pointer, or a size that is not a power of two.
+ */
+Std_ReturnType event_queue_init(event_queue_t *queue, event_queue_event_t *events, uint8 size);
+
+/**
+ * @brief Queues an event, it is dropped and counted if the queue is full.
+ *
+ * @param queue A pointer to an initialized queue.
+ * @param source The key or button the event is about.
+ * @param type The event type.
+ */
+void event_queue_push(event_queue_t *queue, uint8 source, uint8 type);
+
+/**
+ * @brief Takes the oldest event.
+ *
+ * @param queue A pointer to an initialized queue.
+ * @param event A pointer to store the event.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: An event was taken.
+ *         - E_NOT_OK: The queue is empty, or a NULL pointer.
+ */
+Std_ReturnType event_queue_pop(event_queue_t *queue, event_queue_event_t *event);
+
+#endif	/* EVENT_QUEUE_H */
@@ -0,0 +1,503 @@
+/* 
+ * File:   flash_log.c
+ * Author: Salah-Eldin
+ * Description:
+ * This implementation file provides the log-structured record log on SPI NOR flash.
+ * The sequence number counts slots, so the record in a slot always carries the
+ * sequence of the first slot of its sector plus its offset, torn records included.
+ * Created on October 17, 2026
+ */
+
+//========================================================================== 
+//                           Includes                             
+//==========================================================================
+
+#include "flash_log.h"
+
+//========================================================================== 
+//                           Macro Declarations                            
+//========================================================================== 
+#define FLASH_LOG_SEQ_INDEX         0U
+#define FLASH_LOG_PAYLOAD_INDEX     4U
+#define FLASH_LOG_CHECK_INDEX       (FLASH_LOG_RECORD_SIZE - 1U)
+
+#define FLASH_LOG_QUEUE_MASK        (FLASH_LOG_QUEUE_SIZE - 1U)
+
+//========================================================================== 
+//                           Static Variables                            
+//========================================================================== 
+static const spi_flash_t *flash_log_flash = NULL;
+static uint8 flash_log_queue[FLASH_LOG_QUEUE_SIZE][FLASH_LOG_PAYLOAD_SIZE];
+static uint8 flash_log_queue_head = 0;
+static uint8 flash_log_queue_tail = 0;
+static uint32 flash_log_head = 0;           /* slot the next record goes to   */
+static uint32 flash_log_sequence = 0;       /* sequence number of that slot   */
+static uint32 flash_log_count = 0;
+static uint16 flash_log_erase_sector = 0;   /* first sector waiting for an erase */
+static uint8 flash_log_erase_pending = 0;   /* sectors waiting from there on, 0 to 2 */
+static uint8 flash_log_chip_busy = 0;       /* a program or erase was started and not seen done */
+
+static uint32 flash_log_slot_address(uint32 slot);
+static uint16 flash_log_next_sector(uint16 sector);
+static uint8 flash_log_check(const uint8 *record);
+static uint32 flash_log_record_sequence(const uint8 *record);
+static uint8 flash_log_is_blank(const uint8 *record);
+static Std_ReturnType flash_log_read_slot(uint32 slot, uint8 *record);
+static Std_ReturnType flash_log_sector_is_blank(uint16 sector, uint8 *blank);
+static Std_ReturnType flash_log_wait_chip(uint8 wait);
+static void flash_log_schedule_erase(uint16 sector);
+static void flash_log_limit_count(void);
+
+//========================================================================== 
+//                           Function Definitions                            
+//========================================================================== 
+
+/**
+ * @brief Scans the log area and resumes after the newest record.
+ * 
+ * Reads the first record of every sector to find the newest sector, then
+ * binary searches it for the first erased slot. Sectors that must be erased
+ * before the log reaches them are queued for flash_log_tick(). Waits for a
+ * program or erase left running by a reset. Call it once at boot.
+ * 
+ * @param flash A pointer to the initialized flash, must stay valid.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer, the log area does not fit the chip, or the bus is busy.
+ */
+Std_ReturnType flash_log_init(const spi_flash_t *flash)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 record[FLASH_LOG_RECORD_SIZE];
+    uint16 newest_sector = 0;
+    uint32 newest_sequence = 0;
+    uint32 oldest_age = 0;
+    uint8 found = 0;
+    uint8 blank = 0;
+
+    if((NULL == flash) || (flash->size < FLASH_LOG_START_ADDRESS) ||
+       ((flash->size - FLASH_LOG_START_ADDRESS) < ((uint32)FLASH_LOG_SECTORS * SPI_FLASH_SECTOR_SIZE)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        flash_log_flash = flash;
+        flash_log_queue_head = 0;
+        flash_log_queue_tail = 0;
+        flash_log_erase_pending = 0;
+        flash_log_chip_busy = 1;
+        ret = flash_log_wait_chip(1);
+
+        /* The first slot of a sector holds its oldest record, all valid ones lie
+           within FLASH_LOG_SLOTS of each other, so the wrap-aware comparison
+           finds the newest sector even after the sequence wraps */
+        for(uint16 sector = 0; (sector < FLASH_LOG_SECTORS) && (E_OK == ret); sector++)
+        {
+            uint32 slot = (uint32)sector * FLASH_LOG_SLOTS_PER_SECTOR;
+
+            ret = spi_flash_read(flash, flash_log_slot_address(slot), record, FLASH_LOG_RECORD_SIZE);
+            if((E_OK == ret) && (record[FLASH_LOG_CHECK_INDEX] == flash_log_check(record)))
+            {
+                uint32 sequence = flash_log_record_sequence(record);
+                if((0 == found) || ((sint32)(sequence - newest_sequence) > 0))
+                {
+                    /* Every sector seen so far is older by the same step */
+                    oldest_age += found ? (uint32)(sequence - newest_sequence) : 0;
+                    newest_sector = sector;
+                    newest_sequence = sequence;
+                    found = 1;
+                }
+                else if((uint32)(newest_sequence - sequence) > oldest_age)
+                {
+                    oldest_age = (uint32)(newest_sequence - sequence);
+                }
+                else
+                {
+                    /* Between the oldest and the newest */
+                }
+            }
+        }
+
+        if(E_OK == ret)
+        {
+            if(found)
+            {
+                /* Slots fill in order, the erased ones form the tail of the sector */
+                uint16 low = 1;
+                uint16 high = FLASH_LOG_SLOTS_PER_SECTOR;
+                uint32 first = (uint32)newest_sector * FLASH_LOG_SLOTS_PER_SECTOR;
+
+                while((low < high) && (E_OK == ret))
+                {
+                    uint16 middle = (uint16)((low + high) >> 1);
+
+                    ret = spi_flash_read(flash, flash_log_slot_address(first + middle), record,
+                                         FLASH_LOG_RECORD_SIZE);
+                    if(flash_log_is_blank(record))
+                    {
+                        high = middle;
+                    }
+                    else
+                    {
+                        low = (uint16)(middle + 1U);
+                    }
+                }
+                flash_log_head = first + low;
+                if(flash_log_head >= FLASH_LOG_SLOTS)
+                {
+                    flash_log_head = 0;
+                }
+                flash_log_sequence = newest_sequence + low;
+                flash_log_count = (uint32)(flash_log_sequence - newest_sequence) + oldest_age;
+            }
+            else
+            {
+                flash_log_head = 0;
+                flash_log_sequence = 0;
+                flash_log_count = 0;
+            }
+            flash_log_limit_count();
+        }
+
+        /* A reset may have cut an erase-ahead short, or the area holds older data */
+        uint16 head_sector = (uint16)(flash_log_head / FLASH_LOG_SLOTS_PER_SECTOR);
+        if((E_OK == ret) && (0 == (flash_log_head % FLASH_LOG_SLOTS_PER_SECTOR)))
+        {
+            ret = flash_log_sector_is_blank(head_sector, &blank);
+            if((E_OK == ret) && (0 == blank))
+            {
+                flash_log_schedule_erase(head_sector);
+            }
+        }
+        if(E_OK == ret)
+        {
+            ret = flash_log_sector_is_blank(flash_log_next_sector(head_sector), &blank);
+            if((E_OK == ret) && (0 == blank))
+            {
+                flash_log_schedule_erase(flash_log_next_sector(head_sector));
+            }
+        }
+        if(E_OK != ret)
+        {
+            flash_log_flash = NULL;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Queues one record, flash_log_tick() programs it.
+ * 
+ * The payload is copied, so the caller's buffer is free on return. The record
+ * becomes readable once it is programmed.
+ * 
+ * @param payload FLASH_LOG_PAYLOAD_SIZE bytes to store.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL payload, the log is not initialized, or the queue is full.
+ */
+Std_ReturnType flash_log_append(const uint8 *payload)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 *entry;
+
+    if((NULL == payload) || (NULL == flash_log_flash) ||
+       ((uint8)(flash_log_queue_head - flash_log_queue_tail) >= FLASH_LOG_QUEUE_SIZE))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        entry = flash_log_queue[flash_log_queue_head & FLASH_LOG_QUEUE_MASK];
+        for(uint8 index = 0; index < FLASH_LOG_PAYLOAD_SIZE; index++)
+        {
+            entry[index] = payload[index];
+        }
+        flash_log_queue_head++;
+    }
+    return ret;
+}
+
+/**
+ * @brief Moves the log forward by at most one flash operation, call it from the main loop.
+ * 
+ * Returns at once while the chip is busy. Otherwise programs the oldest queued
+ * record, or starts the pending erase-ahead when no record is queued or the
+ * newest record filled the sector before the one being erased.
+ */
+void flash_log_tick(void)
+{
+    uint8 record[FLASH_LOG_RECORD_SIZE];
+    uint8 queued = (flash_log_queue_head != flash_log_queue_tail) ? 1 : 0;
+    uint16 head_sector = (uint16)(flash_log_head / FLASH_LOG_SLOTS_PER_SECTOR);
+    const uint8 *entry;
+
+    if((NULL == flash_log_flash) || (E_OK != flash_log_wait_chip(0)) || flash_log_chip_busy)
+    {
+        /* Not initialized or the chip is still working */
+    }
+    else if(flash_log_erase_pending && ((0 == queued) || (head_sector == flash_log_erase_sector)))
+    {
+        /* Erases run in idle gaps, a record only waits for one when it needs that sector */
+        if(E_OK == spi_flash_sector_erase(flash_log_flash, FLASH_LOG_START_ADDRESS +
+                                          ((uint32)flash_log_erase_sector * SPI_FLASH_SECTOR_SIZE)))
+        {
+            flash_log_chip_busy = 1;
+            flash_log_erase_sector = flash_log_next_sector(flash_log_erase_sector);
+            flash_log_erase_pending--;
+        }
+    }
+    else if(queued)
+    {
+        entry = flash_log_queue[flash_log_queue_tail & FLASH_LOG_QUEUE_MASK];
+        record[FLASH_LOG_SEQ_INDEX] = (uint8)flash_log_sequence;
+        record[FLASH_LOG_SEQ_INDEX + 1U] = (uint8)(flash_log_sequence >> 8);
+        record[FLASH_LOG_SEQ_INDEX + 2U] = (uint8)(flash_log_sequence >> 16);
+        record[FLASH_LOG_SEQ_INDEX + 3U] = (uint8)(flash_log_sequence >> 24);
+        for(uint8 index = 0; index < FLASH_LOG_PAYLOAD_SIZE; index++)
+        {
+            record[FLASH_LOG_PAYLOAD_INDEX + index] = entry[index];
+        }
+        record[FLASH_LOG_CHECK_INDEX] = flash_log_check(record);
+
+        if(E_OK == spi_flash_page_program(flash_log_flash, flash_log_slot_address(flash_log_head),
+                                          record, FLASH_LOG_RECORD_SIZE))
+        {
+            flash_log_chip_busy = 1;
+            flash_log_queue_tail++;
+            flash_log_sequence++;
+            flash_log_count++;
+            flash_log_head++;
+            if(flash_log_head >= FLASH_LOG_SLOTS)
+            {
+                flash_log_head = 0;
+            }
+            if(0 == (flash_log_head % FLASH_LOG_SLOTS_PER_SECTOR))
+            {
+                /* Entered a new sector, the one after it goes next */
+                head_sector = (uint16)(flash_log_head / FLASH_LOG_SLOTS_PER_SECTOR);
+                flash_log_schedule_erase(flash_log_next_sector(head_sector));
+            }
+            flash_log_limit_count();
+        }
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+}
+
+/**
+ * @brief Reads back a record by age.
+ * 
+ * @param age 0 for the newest record, 1 for the one before it and so on.
+ * @param payload A pointer to store FLASH_LOG_PAYLOAD_SIZE bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: No such record, it is corrupted, or the chip is busy.
+ */
+Std_ReturnType flash_log_read(uint32 age, uint8 *payload)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 record[FLASH_LOG_RECORD_SIZE];
+
+    if((NULL == payload) || (age >= flash_log_count) ||
+       (E_OK != flash_log_wait_chip(0)) || flash_log_chip_busy)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        uint32 back = age + 1U;
+        uint32 slot = (back > flash_log_head) ? (flash_log_head + FLASH_LOG_SLOTS - back) : (flash_log_head - back);
+
+        ret = flash_log_read_slot(slot, record);
+        if((E_OK == ret) &&
+           (flash_log_record_sequence(record) == (uint32)(flash_log_sequence - back)))
+        {
+            for(uint8 index = 0; index < FLASH_LOG_PAYLOAD_SIZE; index++)
+            {
+                payload[index] = record[FLASH_LOG_PAYLOAD_INDEX + index];
+            }
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the number of records that can be read back.
+ * 
+ * @param count A pointer to store the number of records, at least
+ *        (FLASH_LOG_SECTORS - 2) sectors of them once the log has wrapped.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType flash_log_get_count(uint32 *count)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == count)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *count = flash_log_count;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reports whether records are waiting or the chip is still programming or erasing.
+ * 
+ * @param busy A pointer to store 1 while busy, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType flash_log_is_busy(uint8 *busy)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == busy)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(flash_log_flash)
+        {
+            ret = flash_log_wait_chip(0);
+        }
+        *busy = ((flash_log_queue_head != flash_log_queue_tail) || flash_log_chip_busy) ? 1 : 0;
+    }
+    return ret;
+}
+
+//========================================================================== 
+//                           Helper Functions                            
+//========================================================================== 
+
+static uint32 flash_log_slot_address(uint32 slot)
+{
+    return FLASH_LOG_START_ADDRESS + (slot * FLASH_LOG_RECORD_SIZE);
+}
+
+static uint16 flash_log_next_sector(uint16 sector)
+{
+    return (uint16)((sector + 1U < FLASH_LOG_SECTORS) ? (sector + 1U) : 0U);
+}
+
+static uint8 flash_log_check(const uint8 *record)
+{
+    uint8 sum = 0;
+
+    for(uint8 index = 0; index < FLASH_LOG_CHECK_INDEX; index++)
+    {
+        sum += record[index];
+    }
+    /* Inverted so an erased (all 0xFF) slot never checks out */
+    return (uint8)~sum;
+}
+
+static uint32 flash_log_record_sequence(const uint8 *record)
+{
+    return (uint32)record[FLASH_LOG_SEQ_INDEX] |
+           ((uint32)record[FLASH_LOG_SEQ_INDEX + 1U] << 8) |
+           ((uint32)record[FLASH_LOG_SEQ_INDEX + 2U] << 16) |
+           ((uint32)record[FLASH_LOG_SEQ_INDEX + 3U] << 24);
+}
+
+static uint8 flash_log_is_blank(const uint8 *record)
+{
+    uint8 all = 0xFF;
+
+    for(uint8 index = 0; index < FLASH_LOG_RECORD_SIZE; index++)
+    {
+        all &= record[index];
+    }
+    return (0xFF == all) ? 1 : 0;
+}
+
+static Std_ReturnType flash_log_read_slot(uint32 slot, uint8 *record)
+{
+    Std_ReturnType ret = spi_flash_read(flash_log_flash, flash_log_slot_address(slot), record,
+                                        FLASH_LOG_RECORD_SIZE);
+
+    if((E_OK == ret) && (record[FLASH_LOG_CHECK_INDEX] != flash_log_check(record)))
+    {
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+
+static Std_ReturnType flash_log_sector_is_blank(uint16 sector, uint8 *blank)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 record[FLASH_LOG_RECORD_SIZE];
+    uint32 slot = (uint32)sector * FLASH_LOG_SLOTS_PER_SECTOR;
+
+    *blank = 1;
+    for(uint16 index = 0; (index < FLASH_LOG_SLOTS_PER_SECTOR) && (E_OK == ret) && *blank; index++)
+    {
+        ret = spi_flash_read(flash_log_flash, flash_log_slot_address(slot + index), record,
+                             FLASH_LOG_RECORD_SIZE);
+        *blank = flash_log_is_blank(record);
+    }
+    return ret;
+}
+
+/**
+ * @brief Clears flash_log_chip_busy once the chip reports idle, polling until
+ *        then when wait is 1. The status is only read after a program or erase.
+ */
+static Std_ReturnType flash_log_wait_chip(uint8 wait)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 busy = 0;
+
+    do
+    {
+        if(flash_log_chip_busy)
+        {
+            ret = spi_flash_is_busy(flash_log_flash, &busy);
+            if((E_OK == ret) && (0 == busy))
+            {
+                flash_log_chip_busy = 0;
+            }
+        }
+    } while(wait && (E_OK == ret) && flash_log_chip_busy);
+    return ret;
+}
+
+/* Pending sectors are consecutive, a new one joins behind the ones not yet erased */
+static void flash_log_schedule_erase(uint16 sector)
+{
+    if(0 == flash_log_erase_pending)
+    {
+        flash_log_erase_sector = sector;
+    }
+    flash_log_erase_pending++;
+}
+
+/**
+ * @brief Keeps the count to the records outside the sectors being erased:
+ *        the head sector up to the head and the FLASH_LOG_SECTORS - 2 full ones
+ *        before it, the sector after the head is always erased ahead.
+ */
+static void flash_log_limit_count(void)
+{
+    uint32 limit = ((uint32)(FLASH_LOG_SECTORS - 2U) * FLASH_LOG_SLOTS_PER_SECTOR) +
+                   (flash_log_head % FLASH_LOG_SLOTS_PER_SECTOR);
+
+    if(flash_log_count > limit)
+    {
+        flash_log_count = limit;
+    }
+}
@@ -0,0 +1,111 @@
+/* 
+ * File:   flash_log.h
+ * Author: Salah-Eldin
+ * Description:
+ * This header file provides an append-only record log on SPI NOR flash.
+ * Records go one after another through a ring of sectors, and the sector after
+ * the newest one is erased ahead of time while the log is idle, so appends
+ * never wait for an erase. Records are queued in RAM and programmed from
+ * flash_log_tick().
+ * Created on October 17, 2026
+ */
+
+#ifndef FLASH_LOG_H
+#define	FLASH_LOG_H
+
+/* ========================================================================== */
+/*                           Includes                                          */
+/* ========================================================================== */
+#include "../SPI_Flash/spi_flash.h"
+#include "flash_log_cfg.h"
+
+/* ========================================================================== */
+/*                           Macro Declarations                                */
+/* ========================================================================== */
+/* Record layout: sequence number (4 bytes, low first), payload, check byte */
+#define FLASH_LOG_PAYLOAD_SIZE          (FLASH_LOG_RECORD_SIZE - 5U)
+#define FLASH_LOG_SLOTS_PER_SECTOR      (SPI_FLASH_SECTOR_SIZE / FLASH_LOG_RECORD_SIZE)
+#define FLASH_LOG_SLOTS                 ((uint32)FLASH_LOG_SECTORS * FLASH_LOG_SLOTS_PER_SECTOR)
+
+/* ========================================================================== */
+/*                     Macro Functions Declarations                            */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                           Data Types Declarations                           */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                         Functions Declarations                              */
+/* ========================================================================== */
+
+/**
+ * @brief Scans the log area and resumes after the newest record.
+ * 
+ * Reads the first record of every sector to find the newest sector, then
+ * binary searches it for the first erased slot. Sectors that must be erased
+ * before the log reaches them are queued for flash_log_tick(). Waits for a
+ * program or erase left running by a reset. Call it once at boot.
+ * 
+ * @param flash A pointer to the initialized flash, must stay valid.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer, the log area does not fit the chip, or the bus is busy.
+ */
+Std_ReturnType flash_log_init(const spi_flash_t *flash);
+
+/**
+ * @brief Queues one record, flash_log_tick() programs it.
+ * 
+ * The payload is copied, so the caller's buffer is free on return. The record
+ * becomes readable once it is programmed.
+ * 
+ * @param payload FLASH_LOG_PAYLOAD_SIZE bytes to store.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL payload, the log is not initialized, or the queue is full.
+ */
+Std_ReturnType flash_log_append(const uint8 *payload);
+
+/**
+ * @brief Moves the log forward by at most one flash operation, call it from the main loop.
+ * 
+ * Returns at once while the chip is busy. Otherwise programs the oldest queued
+ * record, or starts the pending erase-ahead when no record is queued or the
+ * newest record filled the sector before the one being erased.
+ */
+void flash_log_tick(void);
+
+/**
+ * @brief Reads back a record by age.
+ * 
+ * @param age 0 for the newest record, 1 for the one before it and so on.
+ * @param payload A pointer to store FLASH_LOG_PAYLOAD_SIZE bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: No such record, it is corrupted, or the chip is busy.
+ */
+Std_ReturnType flash_log_read(uint32 age, uint8 *payload);
+
+/**
+ * @brief Gets the number of records that can be read back.
+ * 
+ * @param count A pointer to store the number of records, at least
+ *        (FLASH_LOG_SECTORS - 2) sectors of them once the log has wrapped.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType flash_log_get_count(uint32 *count);
+
+/**
+ * @brief Reports whether records are waiting or the chip is still programming or erasing.
+ * 
+ * @param busy A pointer to store 1 while busy, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType flash_log_is_busy(uint8 *busy);
+
+#endif	/* FLASH_LOG_H */
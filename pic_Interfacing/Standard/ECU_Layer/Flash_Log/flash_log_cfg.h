@@ -0,0 +1,60 @@
+/* 
+ * File:   flash_log_cfg.h
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef FLASH_LOG_CFG_H
+#define	FLASH_LOG_CFG_H
+
+/* ========================================================================== */
+/*                           Includes                                          */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                           Macro Declarations                                */
+/* ========================================================================== */
+/* Part of the NOR flash the log rotates through, whole 4 KB sectors */
+#define FLASH_LOG_START_ADDRESS     0x000000UL
+#define FLASH_LOG_SECTORS           256U        /* 1 MB */
+
+/* Bytes per record including the 4-byte sequence number and the check byte */
+#define FLASH_LOG_RECORD_SIZE       16U
+
+/* Records flash_log_append() can hold while the chip is busy, a power of two.
+   A sector erase takes up to 400 ms on the slow parts, size it for the burst
+   of records that may arrive meanwhile */
+#define FLASH_LOG_QUEUE_SIZE        8U
+
+#if (FLASH_LOG_RECORD_SIZE < 8U) || (FLASH_LOG_RECORD_SIZE > 256U) || \
+    ((FLASH_LOG_RECORD_SIZE & (FLASH_LOG_RECORD_SIZE - 1U)) != 0U)
+#error "FLASH_LOG_RECORD_SIZE must be a power of two from 8 to 256, so records never cross a page"
+#endif
+
+#if FLASH_LOG_SECTORS < 3U
+#error "FLASH_LOG_SECTORS must be at least 3, one is always being erased ahead of the newest"
+#endif
+
+#if (FLASH_LOG_START_ADDRESS % 4096UL) != 0UL
+#error "FLASH_LOG_START_ADDRESS must be on a sector boundary"
+#endif
+
+#if (FLASH_LOG_QUEUE_SIZE == 0U) || ((FLASH_LOG_QUEUE_SIZE & (FLASH_LOG_QUEUE_SIZE - 1U)) != 0U) || \
+    (FLASH_LOG_QUEUE_SIZE > 128U)
+#error "FLASH_LOG_QUEUE_SIZE must be a power of two up to 128"
+#endif
+
+/* ========================================================================== */
+/*                     Macro Functions Declarations                            */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                           Data Types Declarations                           */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                         Functions Declarations                              */
+/* ========================================================================== */
+
+#endif	/* FLASH_LOG_CFG_H */
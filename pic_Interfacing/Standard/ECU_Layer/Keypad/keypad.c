@@ -11,6 +11,7 @@
 //                            Includes
 //=========================================================================
 #include "keypad.h"
+#include "../../MCAL_Layer/Interrupt/interrupt_manager.h"
 
 //=========================================================================
 // Define the values corresponding to each key on the keypad
@@ -22,6 +23,9 @@ static const uint8 keypad_values[KEYPAD_ROWS_NUM][KEYPAD_COLUMNS_NUM] = {
     {'#', '0', '=', '+'}
 };
 
+#define KEYPAD_KEY_PRESSED      0x80U
+#define KEYPAD_KEY_SAMPLES      0x7FU
+
 //=========================================================================
 //                           Functions Implementation
 //=========================================================================
@@ -51,6 +55,20 @@ Std_ReturnType keypad_init(keypad_t *keypad) {
             keypad->keypad_columns_pins[columns_counter].direction = GPIO_DIRECTION_INPUT;
             ret = gpio_pin_set_direction(&(keypad->keypad_columns_pins[columns_counter]));
         }
+        ret = gpio_pin_group_init(&(keypad->keypad_rows_group), keypad->keypad_rows_pins, KEYPAD_ROWS_NUM);
+        ret = gpio_pin_group_init(&(keypad->keypad_columns_group), keypad->keypad_columns_pins, KEYPAD_COLUMNS_NUM);
+
+        for (rows_counter = ZERO_INIT; rows_counter < KEYPAD_ROWS_NUM; rows_counter++) {
+            for (columns_counter = ZERO_INIT; columns_counter < KEYPAD_COLUMNS_NUM; columns_counter++) {
+                keypad->key_state[rows_counter][columns_counter] = 0;
+            }
+        }
+        //Rows are all high until the first tick drives row 0
+        keypad->scan_row = KEYPAD_ROWS_NUM - 1;
+        keypad->scan_skip = 1;
+        keypad->repeat_key = NO_KEY;
+        keypad->repeat_count = 0;
+        ret = event_queue_init(&(keypad->event_queue), keypad->events, KEYPAD_EVENT_QUEUE_SIZE);
     }
     return ret;
 }
@@ -67,37 +85,206 @@ Std_ReturnType keypad_init(keypad_t *keypad) {
 Std_ReturnType keypad_get_value(const keypad_t *keypad, uint8 *value) {
     Std_ReturnType ret = E_OK;
     uint8 rows_counter = ZERO_INIT, columns_counter = ZERO_INIT;
-    logic_t column_logic = GPIO_HIGH;
-    *value = NO_KEY;
+    uint8 columns_logic = KEYPAD_COLUMNS_IDLE;
 
     if (NULL == keypad || NULL == value) {
         ret = E_NOT_OK;
     } else {
+        *value = NO_KEY;
         for (rows_counter = ZERO_INIT; rows_counter < KEYPAD_ROWS_NUM; rows_counter++) {
-            ret = gpio_pin_write(&(keypad->keypad_rows_pins[rows_counter]), GPIO_HIGH);
-        }
-
-        for (rows_counter = ZERO_INIT; rows_counter < KEYPAD_ROWS_NUM; rows_counter++) {
-            // Activate one row at a time and read the corresponding column
-            ret = gpio_pin_write(&(keypad->keypad_rows_pins[rows_counter]), GPIO_LOW);
+            // Activate one row at a time, the others stay high in the same write
+            ret = gpio_pin_group_write(&(keypad->keypad_rows_group), (uint8) (KEYPAD_ROWS_IDLE & ~(1U << rows_counter)));
+            // One read of the column port(s) per row instead of one call per column
+            ret = gpio_pin_group_read(&(keypad->keypad_columns_group), &columns_logic);
 
             for (columns_counter = ZERO_INIT; columns_counter < KEYPAD_COLUMNS_NUM; columns_counter++) {
-                ret = gpio_pin_read(&(keypad->keypad_columns_pins[columns_counter]), &column_logic);
-                if (GPIO_LOW == column_logic) {
+                if (0 == (columns_logic & (1U << columns_counter))) {
                     // Determine the pressed key's value based on row and column
                     __delay_ms(20);
-                    ret = gpio_pin_read(&(keypad->keypad_columns_pins[columns_counter]), &column_logic);
-                    while (GPIO_LOW == column_logic) {
-                        ret = gpio_pin_read(&(keypad->keypad_columns_pins[columns_counter]), &column_logic);
-                    }
+                    do {
+                        ret = gpio_pin_group_read(&(keypad->keypad_columns_group), &columns_logic);
+                    } while (0 == (columns_logic & (1U << columns_counter)));
                     *value = keypad_values[rows_counter][columns_counter];
                     break;
                 }
             }
-            ret = gpio_pin_write(&(keypad->keypad_rows_pins[rows_counter]), GPIO_HIGH);
             if (NO_KEY != *value)
                 break;
         }
+        ret = gpio_pin_group_write(&(keypad->keypad_rows_group), KEYPAD_ROWS_IDLE);
+    }
+    return ret;
+}
+
+/**
+ * @brief Scans one keypad row, meant for a periodic timer ISR.
+ * 
+ * Reads the columns of the row driven low by the previous call, updates the
+ * debounce state of its keys, queues press, release and repeat events, then
+ * drives the next row low. Never waits. Must not be mixed with keypad_get_value.
+ * 
+ * @param keypad A pointer to the keypad configuration structure, after keypad_init.
+ */
+void keypad_tick(keypad_t *keypad) {
+    uint8 row = ZERO_INIT, columns_counter = ZERO_INIT;
+    uint8 columns_logic = KEYPAD_COLUMNS_IDLE;
+
+    if (NULL == keypad) {
+        /* Nothing */
+    } else {
+        row = keypad->scan_row;
+
+        //The row has had a whole tick to settle since it was driven
+        if (0 == keypad->scan_skip) {
+            (void) gpio_pin_group_read(&(keypad->keypad_columns_group), &columns_logic);
+
+            for (columns_counter = ZERO_INIT; columns_counter < KEYPAD_COLUMNS_NUM; columns_counter++) {
+                uint8 state = keypad->key_state[row][columns_counter];
+                uint8 pressed = (columns_logic & (1U << columns_counter)) ? 0U : KEYPAD_KEY_PRESSED;
+                uint8 key = keypad_values[row][columns_counter];
+
+                if (pressed == (state & KEYPAD_KEY_PRESSED)) {
+                    //Agrees with the debounced level, any bounce count starts over
+                    keypad->key_state[row][columns_counter] = pressed;
+                    if (pressed && (key == keypad->repeat_key) && (0 == --keypad->repeat_count)) {
+                        keypad->repeat_count = KEYPAD_REPEAT_PERIOD_SCANS;
+                        event_queue_push(&(keypad->event_queue), key, KEYPAD_EVENT_REPEAT);
+                    }
+                } else if (((state & KEYPAD_KEY_SAMPLES) + 1U) < KEYPAD_DEBOUNCE_SCANS) {
+                    keypad->key_state[row][columns_counter] = (uint8) (state + 1U);
+                } else {
+                    keypad->key_state[row][columns_counter] = pressed;
+                    if (pressed) {
+                        //The last key pressed is the one that repeats
+                        keypad->repeat_key = key;
+                        keypad->repeat_count = KEYPAD_REPEAT_DELAY_SCANS;
+                        event_queue_push(&(keypad->event_queue), key, KEYPAD_EVENT_PRESS);
+                    } else {
+                        if (key == keypad->repeat_key) {
+                            keypad->repeat_key = NO_KEY;
+                        }
+                        event_queue_push(&(keypad->event_queue), key, KEYPAD_EVENT_RELEASE);
+                    }
+                }
+            }
+        }
+        keypad->scan_skip = 0;
+
+        row = (uint8) ((row + 1U >= KEYPAD_ROWS_NUM) ? 0U : (row + 1U));
+        (void) gpio_pin_group_write(&(keypad->keypad_rows_group), (uint8) (KEYPAD_ROWS_IDLE & ~(1U << row)));
+        keypad->scan_row = row;
+    }
+}
+
+/**
+ * @brief Takes the oldest event queued by keypad_tick.
+ * 
+ * @param keypad A pointer to the keypad configuration structure.
+ * @param event A pointer to store the event.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: An event was taken.
+ *         - E_NOT_OK: The queue is empty, or a NULL pointer.
+ */
+Std_ReturnType keypad_get_event(keypad_t *keypad, keypad_event_t *event) {
+    Std_ReturnType ret = E_OK;
+    event_queue_event_t queued;
+
+    if (NULL == keypad || NULL == event) {
+        ret = E_NOT_OK;
+    } else {
+        ret = event_queue_pop(&(keypad->event_queue), &queued);
+        if (E_OK == ret) {
+            event->key = queued.source;
+            event->type = queued.type;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reports whether every key is released and settled.
+ * 
+ * @param keypad A pointer to the keypad configuration structure.
+ * @param idle A pointer to store 1 when idle, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType keypad_is_idle(const keypad_t *keypad, uint8 *idle) {
+    Std_ReturnType ret = E_OK;
+    uint8 rows_counter = ZERO_INIT, columns_counter = ZERO_INIT;
+
+    if (NULL == keypad || NULL == idle) {
+        ret = E_NOT_OK;
+    } else {
+        *idle = 1;
+        for (rows_counter = ZERO_INIT; rows_counter < KEYPAD_ROWS_NUM; rows_counter++) {
+            for (columns_counter = ZERO_INIT; columns_counter < KEYPAD_COLUMNS_NUM; columns_counter++) {
+                //Pressed, or a release or press still being counted
+                if (keypad->key_state[rows_counter][columns_counter]) {
+                    *idle = 0;
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+#if KEYPAD_RBX_WAKE==CONFIG_ENABLE
+/**
+ * @brief Registers a handler for the RBx change interrupt of every column pin.
+ * 
+ * @param keypad A pointer to the keypad configuration structure.
+ * @param wake_handler Called from the RBx ISR when a column goes low, it is
+ *        expected to restart the timer that calls keypad_tick.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A column is not on RB4 to RB7, or a NULL pointer.
+ */
+Std_ReturnType keypad_wake_init(const keypad_t *keypad, void (*wake_handler)(void)) {
+    Std_ReturnType ret = E_OK;
+    uint8 columns_counter = ZERO_INIT;
+    ext_interrupt_RBx_t column_int = {.EXT_InterruptHandler_HIGH = NULL, .priority = INTERRUPT_LOW_PRIORITY};
+
+    if (NULL == keypad || NULL == wake_handler) {
+        ret = E_NOT_OK;
+    } else {
+        column_int.EXT_InterruptHandler_LOW = wake_handler;
+        for (columns_counter = ZERO_INIT; (columns_counter < KEYPAD_COLUMNS_NUM) && (E_OK == ret); columns_counter++) {
+            column_int.pin = keypad->keypad_columns_pins[columns_counter];
+            column_int.pin.direction = GPIO_DIRECTION_INPUT;
+            if (PORTB_INDEX != column_int.pin.port || column_int.pin.pin_num < PIN4) {
+                ret = E_NOT_OK;
+            } else {
+                ret = Interrupt_RBx_Init(&column_int);
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Drives every row low so any key press changes a column, once idle.
+ *        The tick timer can then be stopped until the wake handler runs.
+ * 
+ * @param keypad A pointer to the keypad configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A key is still held or settling, keep ticking.
+ */
+Std_ReturnType keypad_wake_arm(keypad_t *keypad) {
+    uint8 idle = 0;
+    Std_ReturnType ret = keypad_is_idle(keypad, &idle);
+
+    if (E_OK == ret && idle) {
+        ret = gpio_pin_group_write(&(keypad->keypad_rows_group), 0);
+        //The columns are high now, the RBx ISR must expect the press going low
+        RBx_Level_Sync();
+        //With every row low the first tick after waking can't tell the row apart
+        keypad->scan_skip = 1;
+    } else {
+        ret = E_NOT_OK;
     }
     return ret;
 }
+#endif
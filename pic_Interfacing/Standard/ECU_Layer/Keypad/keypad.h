@@ -16,10 +16,20 @@
 //=========================================================================
 #include "keypad_cfg.h"
 #include "../../MCAL_Layer/GPIO/gpio.h"
+#include "../Event_Queue/event_queue.h"
+#if KEYPAD_RBX_WAKE==CONFIG_ENABLE
+#include "../../MCAL_Layer/Interrupt/external_interrupt.h"
+#endif
 
 //=========================================================================
 //                           Macro Declarations
 //=========================================================================
+#if ((KEYPAD_EVENT_QUEUE_SIZE & (KEYPAD_EVENT_QUEUE_SIZE - 1U)) != 0U) || (KEYPAD_EVENT_QUEUE_SIZE > EVENT_QUEUE_MAX_SIZE)
+#error "KEYPAD_EVENT_QUEUE_SIZE must be a power of two up to EVENT_QUEUE_MAX_SIZE"
+#endif
+#if (KEYPAD_DEBOUNCE_SCANS < 1) || (KEYPAD_DEBOUNCE_SCANS > 127)
+#error "KEYPAD_DEBOUNCE_SCANS must be 1 to 127"
+#endif
 
 //=========================================================================
 //                       Macro Functions Declarations
@@ -28,10 +38,33 @@
 //=========================================================================
 //                           Data Types Declarations
 //=========================================================================
+typedef enum
+{
+    KEYPAD_EVENT_PRESS = 0,
+    KEYPAD_EVENT_RELEASE,
+    KEYPAD_EVENT_REPEAT
+} keypad_event_type_t;
+
+typedef struct
+{
+    uint8 key;      // Value of the key, as returned by keypad_get_value
+    uint8 type;     // @ref keypad_event_type_t
+} keypad_event_t;
+
 typedef struct
 {
     pin_config_t keypad_rows_pins[KEYPAD_ROWS_NUM];        // Array of pin configurations for keypad rows
     pin_config_t keypad_columns_pins[KEYPAD_COLUMNS_NUM];  // Array of pin configurations for keypad columns
+    gpio_pin_group_t keypad_rows_group;                    // Filled by keypad_init from keypad_rows_pins
+    gpio_pin_group_t keypad_columns_group;                 // Filled by keypad_init from keypad_columns_pins
+    /* Scanner state, reset by keypad_init */
+    uint8 key_state[KEYPAD_ROWS_NUM][KEYPAD_COLUMNS_NUM];  // Bit 7 debounced level, low bits disagreeing samples
+    uint8 scan_row;                                        // Row driven low, read by the next tick
+    uint8 scan_skip;                                       // 1 when the next tick must not sample
+    uint8 repeat_key;                                      // Key that repeats while held, NO_KEY if none
+    uint8 repeat_count;                                    // Scans left to its next repeat event
+    event_queue_event_t events[KEYPAD_EVENT_QUEUE_SIZE];
+    event_queue_t event_queue;                             // Filled by keypad_tick, emptied by keypad_get_event
 } keypad_t;  // Structure to hold the keypad configuration
   
 //=========================================================================
@@ -59,4 +92,62 @@ Std_ReturnType keypad_init(keypad_t *keypad);
  */
 Std_ReturnType keypad_get_value(const keypad_t *keypad, uint8 *value);
 
+/**
+ * @brief Scans one keypad row, meant for a periodic timer ISR.
+ * 
+ * Reads the columns of the row driven low by the previous call, updates the
+ * debounce state of its keys, queues press, release and repeat events, then
+ * drives the next row low. Never waits. Must not be mixed with keypad_get_value.
+ * 
+ * @param keypad A pointer to the keypad configuration structure, after keypad_init.
+ */
+void keypad_tick(keypad_t *keypad);
+
+/**
+ * @brief Takes the oldest event queued by keypad_tick.
+ * 
+ * @param keypad A pointer to the keypad configuration structure.
+ * @param event A pointer to store the event.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: An event was taken.
+ *         - E_NOT_OK: The queue is empty, or a NULL pointer.
+ */
+Std_ReturnType keypad_get_event(keypad_t *keypad, keypad_event_t *event);
+
+/**
+ * @brief Reports whether every key is released and settled.
+ * 
+ * @param keypad A pointer to the keypad configuration structure.
+ * @param idle A pointer to store 1 when idle, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType keypad_is_idle(const keypad_t *keypad, uint8 *idle);
+
+#if KEYPAD_RBX_WAKE==CONFIG_ENABLE
+/**
+ * @brief Registers a handler for the RBx change interrupt of every column pin.
+ * 
+ * @param keypad A pointer to the keypad configuration structure.
+ * @param wake_handler Called from the RBx ISR when a column goes low, it is
+ *        expected to restart the timer that calls keypad_tick.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A column is not on RB4 to RB7, or a NULL pointer.
+ */
+Std_ReturnType keypad_wake_init(const keypad_t *keypad, void (*wake_handler)(void));
+
+/**
+ * @brief Drives every row low so any key press changes a column, once idle.
+ *        The tick timer can then be stopped until the wake handler runs.
+ * 
+ * @param keypad A pointer to the keypad configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A key is still held or settling, keep ticking.
+ */
+Std_ReturnType keypad_wake_arm(keypad_t *keypad);
+#endif
+
 #endif	/* KEYPAD_H */
@@ -20,6 +20,23 @@
 
 #define NO_KEY                  0xFFU
 
+/* All rows or columns high, as a pin group value */
+#define KEYPAD_ROWS_IDLE        ((uint8)((1U << KEYPAD_ROWS_NUM) - 1U))
+#define KEYPAD_COLUMNS_IDLE     ((uint8)((1U << KEYPAD_COLUMNS_NUM) - 1U))
+
+/* Tick driven scanner, keypad_tick() handles one row, a scan is KEYPAD_ROWS_NUM ticks.
+ * Each key is sampled once per scan and changes state after KEYPAD_DEBOUNCE_SCANS
+ * samples in a row that disagree with it. */
+#define KEYPAD_DEBOUNCE_SCANS       3
+/* Scans a key is held before its first repeat event, then between repeats */
+#define KEYPAD_REPEAT_DELAY_SCANS   100
+#define KEYPAD_REPEAT_PERIOD_SCANS  25
+/* Pending events, must be a power of two */
+#define KEYPAD_EVENT_QUEUE_SIZE     8U
+
+/* Wake the scanner on a PORTB change, the columns must be on RB4 to RB7 */
+#define KEYPAD_RBX_WAKE             CONFIG_DISABLE
+
 //=========================================================================
 //                       Macro Functions Declarations
 //=========================================================================
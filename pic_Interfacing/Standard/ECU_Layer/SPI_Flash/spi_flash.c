@@ -0,0 +1,318 @@
+/* 
+ * File:   spi_flash.c
+ * Author: Salah-Eldin
+ * Description:
+ * This implementation file provides the 25-series SPI NOR flash driver. Every command
+ * is one CS frame on the SPI bus manager, the header and the data of a frame go out
+ * as separate blocking transfers with CS held low in between.
+ * Created on October 17, 2026
+ */
+
+//========================================================================== 
+//                           Includes                             
+//==========================================================================
+
+#include "spi_flash.h"
+
+//========================================================================== 
+//                           Macro Declarations                            
+//========================================================================== 
+#define SPI_FLASH_CMD_WRITE_ENABLE          0x06U
+#define SPI_FLASH_CMD_READ_STATUS           0x05U
+#define SPI_FLASH_CMD_PAGE_PROGRAM          0x02U
+#define SPI_FLASH_CMD_FAST_READ             0x0BU
+#define SPI_FLASH_CMD_SECTOR_ERASE          0x20U
+#define SPI_FLASH_CMD_JEDEC_ID              0x9FU
+#define SPI_FLASH_CMD_RELEASE_POWER_DOWN    0xABU
+
+#define SPI_FLASH_STATUS_BUSY               0x01U
+#define SPI_FLASH_STATUS_WEL                0x02U
+
+/* Opcode, 3 address bytes and the fast read dummy byte */
+#define SPI_FLASH_HEADER_SIZE               5U
+#define SPI_FLASH_ADDRESS_HEADER_SIZE       4U
+
+/* Largest piece one SPI_Bus_Transfer_Blocking() call moves */
+#define SPI_FLASH_CHUNK_SIZE                0xFFU
+
+//========================================================================== 
+//                           Static Variables                            
+//========================================================================== 
+static Std_ReturnType spi_flash_range_check(const spi_flash_t *flash, uint32 address, uint32 len);
+static Std_ReturnType spi_flash_write_enable(const spi_flash_t *flash);
+static Std_ReturnType spi_flash_read_status(const spi_flash_t *flash, uint8 *status);
+static Std_ReturnType spi_flash_address_command(const spi_flash_t *flash, uint8 command, uint32 address,
+                                                uint8 header_size, uint8 cs_action);
+static Std_ReturnType spi_flash_data(const spi_flash_t *flash, const uint8 *tx, uint8 *rx, uint16 len);
+
+//========================================================================== 
+//                           Function Definitions                            
+//========================================================================== 
+
+/**
+ * @brief Wakes the chip from deep power-down and identifies it by its JEDEC ID.
+ * 
+ * The SPI bus manager must be initialized first.
+ * 
+ * @param flash A pointer to the flash with its bus device set.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer, the bus is busy, no chip answers or its capacity is not supported.
+ */
+Std_ReturnType spi_flash_init(spi_flash_t *flash)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 command = SPI_FLASH_CMD_RELEASE_POWER_DOWN;
+    uint8 id[4] = {SPI_FLASH_CMD_JEDEC_ID, 0, 0, 0};
+
+    if(NULL == flash)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        flash->size = 0;
+        ret = SPI_Bus_Device_Init(&flash->device);
+        /* A chip left in deep power-down ignores everything else, an awake one ignores this */
+        ret &= SPI_Bus_Transfer_Blocking(&flash->device, &command, NULL, 1, SPI_BUS_CS_RELEASE);
+        __delay_us(SPI_FLASH_RELEASE_DELAY_US);
+        ret &= SPI_Bus_Transfer_Blocking(&flash->device, id, id, sizeof(id), SPI_BUS_CS_RELEASE);
+
+        /* SDI floats high with no chip and reads low when it is shorted */
+        if((E_OK != ret) || (0x00U == id[1]) || (0xFFU == id[1]) ||
+           (id[3] < SPI_FLASH_CAPACITY_CODE_MIN) || (id[3] > SPI_FLASH_CAPACITY_CODE_MAX))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            flash->manufacturer_id = id[1];
+            flash->memory_type = id[2];
+            flash->size = (uint32)1UL << id[3];
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads any number of bytes with the fast read command.
+ * 
+ * @param flash A pointer to the initialized flash.
+ * @param address First byte to read, the read may cross pages and sectors.
+ * @param data A pointer to store the bytes.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer, out of range, or the bus is busy.
+ */
+Std_ReturnType spi_flash_read(const spi_flash_t *flash, uint32 address, uint8 *data, uint16 len)
+{
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == data) || (E_OK != spi_flash_range_check(flash, address, len)))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(len)
+    {
+        ret = spi_flash_address_command(flash, SPI_FLASH_CMD_FAST_READ, address,
+                                        SPI_FLASH_HEADER_SIZE, SPI_BUS_CS_HOLD);
+        if(E_OK == ret)
+        {
+            ret = spi_flash_data(flash, NULL, data, len);
+        }
+    }
+    else
+    {
+        /* Nothing to read */
+    }
+    return ret;
+}
+
+/**
+ * @brief Starts programming bytes inside one page and returns without waiting.
+ * 
+ * Programming only clears bits, the bytes must have been erased before.
+ * 
+ * @param flash A pointer to the initialized flash.
+ * @param address First byte to program.
+ * @param data The bytes to program.
+ * @param len Number of bytes, 1 to SPI_FLASH_PAGE_SIZE, must not cross a page boundary.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer, out of range, crosses a page, or the bus is busy.
+ */
+Std_ReturnType spi_flash_page_program(const spi_flash_t *flash, uint32 address, const uint8 *data, uint16 len)
+{
+    Std_ReturnType ret = E_OK;
+
+    /* The chip wraps to the start of the page instead of crossing it */
+    if((NULL == data) || (0 == len) || (E_OK != spi_flash_range_check(flash, address, len)) ||
+       (((address % SPI_FLASH_PAGE_SIZE) + len) > SPI_FLASH_PAGE_SIZE))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = spi_flash_write_enable(flash);
+        if(E_OK == ret)
+        {
+            ret = spi_flash_address_command(flash, SPI_FLASH_CMD_PAGE_PROGRAM, address,
+                                            SPI_FLASH_ADDRESS_HEADER_SIZE, SPI_BUS_CS_HOLD);
+        }
+        if(E_OK == ret)
+        {
+            /* Programming starts when CS goes high after the last byte */
+            ret = spi_flash_data(flash, data, NULL, len);
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Starts erasing the sector holding an address to 0xFF and returns without waiting.
+ * 
+ * @param flash A pointer to the initialized flash.
+ * @param address Any address inside the SPI_FLASH_SECTOR_SIZE sector.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer, out of range, or the bus is busy.
+ */
+Std_ReturnType spi_flash_sector_erase(const spi_flash_t *flash, uint32 address)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(E_OK != spi_flash_range_check(flash, address, 1))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = spi_flash_write_enable(flash);
+        if(E_OK == ret)
+        {
+            ret = spi_flash_address_command(flash, SPI_FLASH_CMD_SECTOR_ERASE,
+                                            address & ~(SPI_FLASH_SECTOR_SIZE - 1UL),
+                                            SPI_FLASH_ADDRESS_HEADER_SIZE, SPI_BUS_CS_RELEASE);
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reports whether a program or erase is still running in the chip.
+ * 
+ * @param flash A pointer to the initialized flash.
+ * @param busy A pointer to store 1 while the chip is busy, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer or the bus is busy.
+ */
+Std_ReturnType spi_flash_is_busy(const spi_flash_t *flash, uint8 *busy)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 status = 0;
+
+    if((NULL == flash) || (NULL == busy))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = spi_flash_read_status(flash, &status);
+        *busy = (status & SPI_FLASH_STATUS_BUSY) ? 1 : 0;
+    }
+    return ret;
+}
+
+//========================================================================== 
+//                           Helper Functions                            
+//========================================================================== 
+
+static Std_ReturnType spi_flash_range_check(const spi_flash_t *flash, uint32 address, uint32 len)
+{
+    Std_ReturnType ret = E_OK;
+
+    /* size is 0 until spi_flash_init() found a chip */
+    if((NULL == flash) || (address >= flash->size) || (len > (flash->size - address)))
+    {
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Sets the write enable latch and checks it took, a write protected
+ *        status register or a missing chip leaves it clear.
+ */
+static Std_ReturnType spi_flash_write_enable(const spi_flash_t *flash)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 command = SPI_FLASH_CMD_WRITE_ENABLE;
+    uint8 status = 0;
+
+    ret = SPI_Bus_Transfer_Blocking(&flash->device, &command, NULL, 1, SPI_BUS_CS_RELEASE);
+    if(E_OK == ret)
+    {
+        ret = spi_flash_read_status(flash, &status);
+    }
+    if((E_OK == ret) && (SPI_FLASH_STATUS_WEL != (status & (SPI_FLASH_STATUS_WEL | SPI_FLASH_STATUS_BUSY))))
+    {
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+
+static Std_ReturnType spi_flash_read_status(const spi_flash_t *flash, uint8 *status)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 frame[2] = {SPI_FLASH_CMD_READ_STATUS, SPI_TRANSFER_FILL_BYTE};
+
+    ret = SPI_Bus_Transfer_Blocking(&flash->device, frame, frame, sizeof(frame), SPI_BUS_CS_RELEASE);
+    *status = frame[1];
+    return ret;
+}
+
+/**
+ * @brief Sends an opcode with a 24-bit address, most significant byte first,
+ *        plus the dummy byte when header_size is SPI_FLASH_HEADER_SIZE.
+ */
+static Std_ReturnType spi_flash_address_command(const spi_flash_t *flash, uint8 command, uint32 address,
+                                                uint8 header_size, uint8 cs_action)
+{
+    uint8 header[SPI_FLASH_HEADER_SIZE];
+
+    header[0] = command;
+    header[1] = (uint8)(address >> 16);
+    header[2] = (uint8)(address >> 8);
+    header[3] = (uint8)address;
+    header[4] = SPI_TRANSFER_FILL_BYTE;
+    return SPI_Bus_Transfer_Blocking(&flash->device, header, NULL, header_size, cs_action);
+}
+
+/**
+ * @brief Moves the data phase of a frame whose header left CS low, in chunks
+ *        that keep CS low up to the last one.
+ */
+static Std_ReturnType spi_flash_data(const spi_flash_t *flash, const uint8 *tx, uint8 *rx, uint16 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 chunk;
+
+    while((E_OK == ret) && len)
+    {
+        chunk = (len > SPI_FLASH_CHUNK_SIZE) ? SPI_FLASH_CHUNK_SIZE : (uint8)len;
+        len = (uint16)(len - chunk);
+        ret = SPI_Bus_Transfer_Blocking(&flash->device, tx, rx, chunk,
+                                        len ? SPI_BUS_CS_HOLD : SPI_BUS_CS_RELEASE);
+        if(tx)
+        {
+            tx += chunk;
+        }
+        if(rx)
+        {
+            rx += chunk;
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,109 @@
+/* 
+ * File:   spi_flash.h
+ * Author: Salah-Eldin
+ * Description:
+ * This header file provides a driver for 25-series SPI NOR flash on the SPI bus manager.
+ * Page programs and sector erases are only started here, the caller polls
+ * spi_flash_is_busy() and keeps running while the chip works.
+ * Created on October 17, 2026
+ */
+
+#ifndef SPI_FLASH_H
+#define	SPI_FLASH_H
+
+/* ========================================================================== */
+/*                           Includes                                          */
+/* ========================================================================== */
+#include "../../MCAL_Layer/SPI/spi_bus.h"
+#include "spi_flash_cfg.h"
+
+/* ========================================================================== */
+/*                           Macro Declarations                                */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                     Macro Functions Declarations                            */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                           Data Types Declarations                           */
+/* ========================================================================== */
+/**
+ * @brief A NOR flash chip on the SPI bus, device is set by the application,
+ *        the rest is filled in by spi_flash_init() from the JEDEC ID.
+ */
+typedef struct
+{
+    spi_bus_device_t device;    /* Mode 0 or 3, SPI_MASTER_FOSC_DIV4 is fine for every part */
+    uint8 manufacturer_id;
+    uint8 memory_type;
+    uint32 size;                /* Bytes */
+} spi_flash_t;
+
+/* ========================================================================== */
+/*                         Functions Declarations                              */
+/* ========================================================================== */
+
+/**
+ * @brief Wakes the chip from deep power-down and identifies it by its JEDEC ID.
+ * 
+ * The SPI bus manager must be initialized first.
+ * 
+ * @param flash A pointer to the flash with its bus device set.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer, the bus is busy, no chip answers or its capacity is not supported.
+ */
+Std_ReturnType spi_flash_init(spi_flash_t *flash);
+
+/**
+ * @brief Reads any number of bytes with the fast read command.
+ * 
+ * @param flash A pointer to the initialized flash.
+ * @param address First byte to read, the read may cross pages and sectors.
+ * @param data A pointer to store the bytes.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer, out of range, or the bus is busy.
+ */
+Std_ReturnType spi_flash_read(const spi_flash_t *flash, uint32 address, uint8 *data, uint16 len);
+
+/**
+ * @brief Starts programming bytes inside one page and returns without waiting.
+ * 
+ * Programming only clears bits, the bytes must have been erased before.
+ * 
+ * @param flash A pointer to the initialized flash.
+ * @param address First byte to program.
+ * @param data The bytes to program.
+ * @param len Number of bytes, 1 to SPI_FLASH_PAGE_SIZE, must not cross a page boundary.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer, out of range, crosses a page, or the bus is busy.
+ */
+Std_ReturnType spi_flash_page_program(const spi_flash_t *flash, uint32 address, const uint8 *data, uint16 len);
+
+/**
+ * @brief Starts erasing the sector holding an address to 0xFF and returns without waiting.
+ * 
+ * @param flash A pointer to the initialized flash.
+ * @param address Any address inside the SPI_FLASH_SECTOR_SIZE sector.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer, out of range, or the bus is busy.
+ */
+Std_ReturnType spi_flash_sector_erase(const spi_flash_t *flash, uint32 address);
+
+/**
+ * @brief Reports whether a program or erase is still running in the chip.
+ * 
+ * @param flash A pointer to the initialized flash.
+ * @param busy A pointer to store 1 while the chip is busy, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: NULL pointer or the bus is busy.
+ */
+Std_ReturnType spi_flash_is_busy(const spi_flash_t *flash, uint8 *busy);
+
+#endif	/* SPI_FLASH_H */
@@ -0,0 +1,41 @@
+/* 
+ * File:   spi_flash_cfg.h
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef SPI_FLASH_CFG_H
+#define	SPI_FLASH_CFG_H
+
+/* ========================================================================== */
+/*                           Includes                                          */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                           Macro Declarations                                */
+/* ========================================================================== */
+/* Geometry shared by the 25-series NOR parts (W25Q, SST26, AT25SF, MX25L) */
+#define SPI_FLASH_PAGE_SIZE             256U
+#define SPI_FLASH_SECTOR_SIZE           4096UL
+
+/* Release from deep power-down (tRES1), 3 us on the W25Q, 30 us covers the slower parts */
+#define SPI_FLASH_RELEASE_DELAY_US      30U
+
+/* JEDEC capacity codes accepted by spi_flash_init(), 2^code bytes, 3-byte addressing */
+#define SPI_FLASH_CAPACITY_CODE_MIN     0x10U   /* 64 KB */
+#define SPI_FLASH_CAPACITY_CODE_MAX     0x18U   /* 16 MB */
+
+/* ========================================================================== */
+/*                     Macro Functions Declarations                            */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                           Data Types Declarations                           */
+/* ========================================================================== */
+
+/* ========================================================================== */
+/*                         Functions Declarations                              */
+/* ========================================================================== */
+
+#endif	/* SPI_FLASH_CFG_H */
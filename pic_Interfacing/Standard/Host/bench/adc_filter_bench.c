@@ -0,0 +1,162 @@
+/*
+ *  ADC result filter benchmark.
+ *
+ *  Runs a dithered constant input through the CCP2 triggered ADC path of
+ *  adc.c with each filter configuration attached: the simulator converts the
+ *  sample, ADC_ISR reads it and feeds ADC_Filter_Push, and the filtered
+ *  values land in the trigger ring. Prints, per configuration, the host time
+ *  per ADC_ISR call, the hooked SFR accesses per ADC_ISR call (about one
+ *  instruction each, average and worst call) and how far the mean output is
+ *  from the exact input. Also checks a left justified configuration can't be
+ *  attached. Exits non-zero on a wrong output count or that check.
+ *
+ *  Only host time and simulator counts are measured here. The filter itself
+ *  touches no SFR, so the access counts are the ISR's register traffic; the
+ *  PIC18 cycles of the filter arithmetic are not measured, time ADC_ISR with
+ *  the MPLAB simulator stopwatch for those.
+ *
+ *     make -C Host bench && Host/out/bench/adc_filter_bench
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "pic18f4620_sim.h"
+#include "../MCAL_Layer/ADC/adc.h"
+#include "../MCAL_Layer/Interrupt/interrupt_manager.h"
+
+#define BENCH_SAMPLES   65536UL
+#define BENCH_INPUT     512.37      /* LSB, between two codes on purpose */
+
+typedef struct {
+    const char *name;
+    adc_filter_config_t config;
+} bench_case_t;
+
+static const bench_case_t bench_cases[] = {
+    { "raw",            { ADC_FILTER_NONE,           0, 0 } },
+    { "os1",            { ADC_FILTER_NONE,           1, 0 } },
+    { "os2",            { ADC_FILTER_NONE,           2, 0 } },
+    { "os3",            { ADC_FILTER_NONE,           3, 0 } },
+    { "iir2",           { ADC_FILTER_IIR,            0, 2 } },
+    { "os2+iir4",       { ADC_FILTER_IIR,            2, 4 } },
+    { "os2+iir8",       { ADC_FILTER_IIR,            2, 8 } },
+    { "ma4",            { ADC_FILTER_MOVING_AVERAGE, 0, 2 } },
+    { "os2+ma16",       { ADC_FILTER_MOVING_AVERAGE, 2, 4 } },
+};
+
+static const adc_config_t bench_adc_left = {
+    .ADC_InterruptHandler = NULL,
+    .acq_time = ADC_12_TAD,
+    .clock = ADC_CLOCK_FOSC_DIV_16,
+    .channel = ADC_CHANNEL_AN0,
+    .res_format = ADC_RESULT_LEFT,
+};
+
+static const adc_config_t bench_adc = {
+    .ADC_InterruptHandler = NULL,
+    .acq_time = ADC_12_TAD,
+    .clock = ADC_CLOCK_FOSC_DIV_16,
+    .channel = ADC_CHANNEL_AN0,
+    .res_format = ADC_RESULT_RIGHT,
+};
+
+/* Small LCG, the same dither sequence for every case */
+static unsigned long bench_seed;
+static uint16 bench_sample(void)
+{
+    bench_seed = bench_seed * 1103515245UL + 12345UL;
+    /* Uniform dither of +-1 LSB before the converter rounds */
+    double noise = ((double)((bench_seed >> 16) & 0x7FFF) / 32767.0) * 2.0 - 1.0;
+    return (uint16)(BENCH_INPUT + noise + 0.5);
+}
+
+static double bench_ns(const struct timespec *t0, const struct timespec *t1)
+{
+    return (t1->tv_sec - t0->tv_sec) * 1e9 + (t1->tv_nsec - t0->tv_nsec);
+}
+
+int main(void)
+{
+    int failed = 0;
+    double clock_ns = 0;
+    struct timespec t0, t1;
+    adc_filter_t filter;
+
+    /* Cost of the timing calls themselves, taken off every ADC_ISR time below */
+    for (unsigned long n = 0; n < BENCH_SAMPLES; n++)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        clock_ns += bench_ns(&t0, &t1);
+    }
+    clock_ns /= BENCH_SAMPLES;
+
+    pic18_sim_reset();
+    ADC_Filter_Init(&filter, &bench_cases[1].config);
+    if (E_NOT_OK != ADC_Filter_Attach(&bench_adc_left, &filter))
+    {
+        printf("FAIL: a left justified result format was accepted\n");
+        failed = 1;
+    }
+
+    printf("%-10s %8s %9s %8s %8s %10s %9s\n",
+           "case", "outputs", "ns/isr", "avg_sfr", "max_sfr", "mean", "err_lsb");
+
+    for (unsigned i = 0; i < sizeof(bench_cases) / sizeof(bench_cases[0]); i++)
+    {
+        const bench_case_t *bc = &bench_cases[i];
+        unsigned long outputs = 0, max_sfr = 0, total_sfr = 0;
+        double output_sum = 0, isr_ns = 0;
+        uint16 ring[ADC_TRIGGER_BUFFER_SIZE];
+        uint8 read_len = 0;
+
+        pic18_sim_reset();
+        ADC_Init(&bench_adc);
+        ADC_Filter_Init(&filter, &bc->config);
+        ADC_Filter_Attach(&bench_adc, &filter);
+        ADC_Trigger_Start(&bench_adc, ADC_CHANNEL_AN0);
+        bench_seed = 1;
+        for (unsigned long n = 0; n < BENCH_SAMPLES; n++)
+        {
+            /* What the CCP2 special event does on the target */
+            pic18_sim_adc_set_input(ADC_CHANNEL_AN0, bench_sample());
+            ADC_START_CONV();
+            pic18_sim_sync();
+
+            uint32_t sfr = pic18_sim_access_count();
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            ADC_ISR();
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            sfr = pic18_sim_access_count() - sfr;
+
+            isr_ns += bench_ns(&t0, &t1) - clock_ns;
+            total_sfr += sfr;
+            if (sfr > max_sfr)
+            {
+                max_sfr = sfr;
+            }
+            ADC_Trigger_Read(ring, ADC_TRIGGER_BUFFER_SIZE, &read_len);
+            for (uint8 k = 0; k < read_len; k++)
+            {
+                outputs++;
+                output_sum += ring[k];
+            }
+        }
+        ADC_Trigger_Stop();
+        ADC_Filter_Attach(&bench_adc, NULL);
+
+        /* Output LSBs are 2^-n input LSBs */
+        double scale = (double)(1U << bc->config.oversample_bits);
+        double mean = outputs ? output_sum / outputs : 0;
+        printf("%-10s %8lu %9.1f %8.2f %8lu %10.2f %+9.2f\n",
+               bc->name, outputs, isr_ns / BENCH_SAMPLES, (double)total_sfr / BENCH_SAMPLES,
+               max_sfr, mean, mean - BENCH_INPUT * scale);
+        if (outputs != (BENCH_SAMPLES >> (2U * bc->config.oversample_bits)))
+        {
+            failed = 1;
+        }
+    }
+    printf("ns/isr: host time of one ADC_ISR call, %.1f ns of timing overhead taken off\n", clock_ns);
+    printf("sfr: hooked SFR accesses per ADC_ISR call in the simulator\n");
+    return failed;
+}
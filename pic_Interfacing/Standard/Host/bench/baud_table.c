@@ -0,0 +1,123 @@
+/*
+ *  Baud rate and PWM period table.
+ *
+ *  Runs the integer Eusart_Baudrate_Compute over every baud rate generator
+ *  mode and the usual baud rates, and CCP_Init over a set of PWM
+ *  frequencies, then checks each register value and reported error against
+ *  an exact double precision reference: the register must be the nearest
+ *  one and the error within 0.01 %. Prints one row per case and a summary,
+ *  exits non-zero on any mismatch.
+ *
+ *     make -C Host bench && Host/out/bench/baud_table
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include "pic18f4620_sim.h"
+#include "../MCAL_Layer/USART/usart.h"
+#include "../MCAL_Layer/CCP/ccp.h"
+
+static const struct {
+    const char *name;
+    usart_baudrate_gen_t generator;
+    double divisor;
+    double brg_max;
+} modes[] = {
+    { "async8_low",   EUSART_ASYNC_8BITS_LOW_SPEED_BAUDRATE,   64.0, 255.0 },
+    { "async8_high",  EUSART_ASYNC_8BITS_HIGH_SPEED_BAUDRATE,  16.0, 255.0 },
+    { "async16_low",  EUSART_ASYNC_16BITS_LOW_SPEED_BAUDRATE,  16.0, 65535.0 },
+    { "async16_high", EUSART_ASYNC_16BITS_HIGH_SPEED_BAUDRATE, 4.0,  65535.0 },
+    { "sync8",        EUSART_SYNC_8BITS_BAUDRATE,              4.0,  255.0 },
+    { "sync16",       EUSART_SYNC_16BITS_BAUDRATE,             4.0,  65535.0 },
+};
+
+static const uint32 baudrates[] = {
+    110, 300, 1200, 2400, 4800, 9600, 14400, 19200, 38400, 57600, 115200, 250000, 500000, 1000000
+};
+
+static const uint32 pwm_freqs[] = { 100, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 250000 };
+
+static const struct {
+    uint8 code;
+    double div;
+} prescalers[] = {
+    { CCP_TIMER2_PRESCALER_DIV_1, 1.0 },
+    { CCP_TIMER2_PRESCALER_DIV_4, 4.0 },
+    { CCP_TIMER2_PRESCALER_DIV_16, 16.0 },
+};
+
+static unsigned failures, rows;
+
+static void check(const char *what, int ok)
+{
+    rows++;
+    if (!ok)
+    {
+        failures++;
+        printf("  MISMATCH %s\n", what);
+    }
+}
+
+int main(void)
+{
+    printf("FOSC %lu Hz\n\n%-13s %8s %6s %8s | %6s %8s\n",
+           (unsigned long)_XTAL_FREQ, "mode", "baud", "brg", "err%", "ref", "ref_err%");
+
+    for (unsigned m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        for (unsigned b = 0; b < sizeof(baudrates) / sizeof(baudrates[0]); b++)
+        {
+            uint32 baud = baudrates[b];
+            uint16 brg = 0;
+            sint16 err = 0;
+            Std_ReturnType ret = Eusart_Baudrate_Compute(baud, modes[m].generator, &brg, &err);
+
+            /* Reference: nearest register value and its exact error */
+            double ratio = (double)_XTAL_FREQ / (modes[m].divisor * baud);
+            double ref = floor(ratio + 0.5) - 1.0;
+            /* Faster than FOSC / divisor is out of range even if it rounds to 0 */
+            int ref_ok = (ratio >= 1.0) && (ref <= modes[m].brg_max);
+            double ref_err = ref_ok ? ((double)_XTAL_FREQ / (modes[m].divisor * (ref + 1.0)) / baud - 1.0) * 100.0 : 0.0;
+
+            if (!ref_ok)
+            {
+                printf("%-13s %8lu %6s %8s | %6s %8s\n", modes[m].name, (unsigned long)baud, "-", "-", "-", "-");
+                check("range", E_NOT_OK == ret);
+                continue;
+            }
+            printf("%-13s %8lu %6u %+8.2f | %6.0f %+8.3f\n",
+                   modes[m].name, (unsigned long)baud, brg, err / 100.0, ref, ref_err);
+            check("brg", (E_OK == ret) && (brg == (uint16)ref));
+            check("error", fabs(err / 100.0 - ref_err) <= 0.01 + 1e-9);
+        }
+    }
+
+    printf("\n%-8s %8s %6s | %6s\n", "prescale", "pwm_hz", "pr2", "ref");
+    for (unsigned p = 0; p < sizeof(prescalers) / sizeof(prescalers[0]); p++)
+    {
+        for (unsigned f = 0; f < sizeof(pwm_freqs) / sizeof(pwm_freqs[0]); f++)
+        {
+            ccp_t ccp = { 0 };
+            ccp.CCPx = CCP2_INST;
+            ccp.mode = CCP_PWM_MD;
+            ccp.PWM_Freq = pwm_freqs[f];
+            ccp.timer2_prescaler = prescalers[p].code;
+
+            pic18_sim_reset();
+            Std_ReturnType ret = CCP_Init(&ccp);
+
+            double ref = floor((double)_XTAL_FREQ / (4.0 * prescalers[p].div * pwm_freqs[f]) + 0.5) - 1.0;
+            if ((ref < 0.0) || (ref > 255.0))
+            {
+                printf("%-8.0f %8lu %6s | %6s\n", prescalers[p].div, (unsigned long)pwm_freqs[f], "-", "-");
+                check("pr2 range", E_NOT_OK == ret);
+                continue;
+            }
+            printf("%-8.0f %8lu %6u | %6.0f\n", prescalers[p].div, (unsigned long)pwm_freqs[f], PR2, ref);
+            check("pr2", (E_OK == ret) && (PR2 == (uint8)ref));
+        }
+    }
+
+    printf("\n%u checks, %u mismatches\n", rows, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,170 @@
+/*
+ *  SPI NOR flash log benchmark.
+ *
+ *  Runs the flash log on the file-backed NOR emulator (spi_flash_sim.c)
+ *  through enough records to wrap the log area twice, then simulates a
+ *  reboot and checks the log resumes with the same count and newest record.
+ *  Prints, per record, the SPI bytes exchanged with CS low and the bus time
+ *  they take at Fosc/4 (2 MHz), the hooked SFR accesses (about one
+ *  instruction each), and the sector erases per 1000 records. For scale it
+ *  also prints the bus time of the same record on a 24Cxx I2C EEPROM at
+ *  100 kHz, before that part's own write cycle. Exits non-zero on any
+ *  mismatch.
+ *
+ *  Chip program and erase times are not modelled, the emulator keeps the
+ *  busy bit up for a few status reads only, enough to exercise the polling.
+ *
+ *     make -C Host bench && Host/out/bench/flash_log_bench [backing file]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "spi_flash_sim.h"
+#include "../ECU_Layer/Flash_Log/flash_log.h"
+
+#define BENCH_FLASH_SIZE        (1UL << 20)
+#define BENCH_RECORDS           (2UL * FLASH_LOG_SLOTS + 1000UL)
+#define BENCH_PROGRAM_POLLS     2U
+#define BENCH_ERASE_POLLS       20U
+
+/* 24Cxx page write: START, control byte, 2 address bytes, data, STOP, 9 bits a byte */
+#define BENCH_I2C_BITS(bytes)   (((2UL + 1UL + (bytes)) * 9UL) + 2UL)
+#define BENCH_I2C_HZ            100000UL
+#define BENCH_SPI_HZ            2000000UL
+
+static spi_flash_t bench_flash = {
+    .device = { .cs = { .port = PORTD_INDEX, .pin_num = PIN0 }, .spi_mode = SPI_MASTER_FOSC_DIV4 }
+};
+static unsigned long bench_errors;
+
+static void bench_payload(uint32_t n, uint8 *payload)
+{
+    for (uint8 index = 0; index < FLASH_LOG_PAYLOAD_SIZE; index++)
+    {
+        payload[index] = (uint8)((n >> ((index & 3U) * 8U)) ^ (index * 0x35U));
+    }
+}
+
+static int bench_boot(const char *path)
+{
+    SPI_Config config = { .spi_mode = SPI_MASTER_FOSC_DIV4 };
+
+    pic18_sim_reset();
+    if (spi_flash_sim_open(path, BENCH_FLASH_SIZE, PORTD_INDEX, PIN0))
+    {
+        return -1;
+    }
+    spi_flash_sim_set_busy(BENCH_PROGRAM_POLLS, BENCH_ERASE_POLLS);
+    if ((E_OK != SPI_Bus_Init(&config)) || (E_OK != spi_flash_init(&bench_flash)) ||
+        (E_OK != flash_log_init(&bench_flash)))
+    {
+        return -1;
+    }
+    return 0;
+}
+
+static void bench_check_newest(uint32_t appended, uint32 expected_count)
+{
+    uint8 got[FLASH_LOG_PAYLOAD_SIZE], expected[FLASH_LOG_PAYLOAD_SIZE];
+    uint32 count = 0;
+
+    flash_log_get_count(&count);
+    if (count != expected_count)
+    {
+        printf("MISMATCH count %lu, expected %lu\n", (unsigned long)count, (unsigned long)expected_count);
+        bench_errors++;
+    }
+    for (uint32 age = 0; age < count; age += 97U)
+    {
+        bench_payload(appended - 1U - age, expected);
+        if ((E_OK != flash_log_read(age, got)) || memcmp(got, expected, sizeof(got)))
+        {
+            if (bench_errors < 10)
+            {
+                printf("MISMATCH record of age %lu\n", (unsigned long)age);
+            }
+            bench_errors++;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    char path[] = "/tmp/flash_log_benchXXXXXX";
+    uint8 payload[FLASH_LOG_PAYLOAD_SIZE];
+    uint8 busy = 1;
+    uint32 count = 0;
+    uint32_t appended = 0, accesses, bytes, erases;
+    int fd = -1;
+
+    if (argc > 1)
+    {
+        strncpy(path, argv[1], sizeof(path) - 1);
+        path[sizeof(path) - 1] = '\0';
+        unlink(path);
+    }
+    else if ((fd = mkstemp(path)) >= 0)
+    {
+        close(fd);
+    }
+    if (bench_boot(path))
+    {
+        printf("FAIL: no flash\n");
+        return 1;
+    }
+    printf("flash %02X %02X, %lu bytes, log of %u sectors, %u byte records\n",
+           bench_flash.manufacturer_id, bench_flash.memory_type, (unsigned long)bench_flash.size,
+           FLASH_LOG_SECTORS, FLASH_LOG_RECORD_SIZE);
+
+    accesses = pic18_sim_access_count();
+    bytes = spi_flash_sim_byte_count();
+    while (appended < BENCH_RECORDS)
+    {
+        bench_payload(appended, payload);
+        if (E_OK == flash_log_append(payload))
+        {
+            appended++;
+        }
+        flash_log_tick();
+    }
+    while (busy)
+    {
+        flash_log_tick();
+        flash_log_is_busy(&busy);
+    }
+    accesses = pic18_sim_access_count() - accesses;
+    bytes = spi_flash_sim_byte_count() - bytes;
+    erases = spi_flash_sim_erase_count();
+
+    flash_log_get_count(&count);
+    bench_check_newest(appended, count);
+    if (count < (uint32)((FLASH_LOG_SECTORS - 2U) * FLASH_LOG_SLOTS_PER_SECTOR))
+    {
+        printf("MISMATCH count %lu below the guaranteed history\n", (unsigned long)count);
+        bench_errors++;
+    }
+
+    spi_flash_sim_close();
+    if (bench_boot(path))
+    {
+        printf("FAIL: reboot\n");
+        return 1;
+    }
+    bench_check_newest(appended, count);
+
+    printf("%-22s %10s %10s\n", "per record", "spi_flash", "i2c_24cxx");
+    printf("%-22s %10.1f %10lu\n", "bus bytes", (double)bytes / appended, 3UL + FLASH_LOG_RECORD_SIZE);
+    printf("%-22s %10.1f %10.1f\n", "bus time (us)",
+           (double)bytes * 8e6 / BENCH_SPI_HZ / appended,
+           (double)BENCH_I2C_BITS(FLASH_LOG_RECORD_SIZE) * 1e6 / BENCH_I2C_HZ);
+    printf("%-22s %10.1f\n", "sfr accesses", (double)accesses / appended);
+    printf("%-22s %10.2f\n", "erases / 1000", 1000.0 * erases / appended);
+    printf("records %lu, readable %lu\n", (unsigned long)appended, (unsigned long)count);
+
+    spi_flash_sim_close();
+    unlink(path);
+    printf("%s: %lu mismatches\n", bench_errors ? "FAIL" : "PASS", bench_errors);
+    return bench_errors ? 1 : 0;
+}
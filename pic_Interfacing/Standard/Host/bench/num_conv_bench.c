@@ -0,0 +1,236 @@
+/*
+ *  Integer to ASCII conversion benchmark.
+ *
+ *  Checks Num_Conv against the C library: every uint8 and uint16 value, a
+ *  spread of uint32 values, and fixed-point values with every decimals
+ *  setting, each with and without padding. Then prints, per function, the
+ *  host time per call next to sprintf formatting the same values, and the
+ *  same for the uint32 value that takes the most subtraction steps, repeated
+ *  (its branches predict perfectly on the host). It also counts the uint16 values
+ *  the old sprintf(str, "%d", ...) path got wrong with the 16-bit int of XC8.
+ *  Exits non-zero on any mismatch.
+ *
+ *  These are host timings only. The conversions touch no SFR, so the
+ *  simulator has nothing to count, and no PIC18 cycle figure is produced for
+ *  either side. Measure Num_Conv and XC8's printf on the target, or with the
+ *  MPLAB simulator stopwatch around one call, to compare them there.
+ *
+ *     make -C Host bench && Host/out/bench/num_conv_bench
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../Utilities/Num_Conv/num_conv.h"
+
+#define BENCH_UINT32_VALUES     200000UL
+
+static unsigned long bench_errors;
+
+static void bench_check(const char *name, const char *got, const char *expected)
+{
+    if (strcmp(got, expected))
+    {
+        if (bench_errors < 10)
+        {
+            printf("MISMATCH %s: got \"%s\", expected \"%s\"\n", name, got, expected);
+        }
+        bench_errors++;
+    }
+}
+
+/* Small LCG, spread over all 32 bits and biased towards short values too */
+static unsigned long bench_seed = 1;
+static uint32 bench_uint32(void)
+{
+    bench_seed = bench_seed * 1103515245UL + 12345UL;
+    uint32 value = (uint32)(((bench_seed >> 8) & 0xFFFFFFUL) << 8) ^ (uint32)(bench_seed >> 16);
+    /* uint32 is an unsigned long, 64 bits on the host, keep to the target range */
+    return (value & 0xFFFFFFFFUL) >> ((bench_seed >> 3) & 0x1F);
+}
+
+static double bench_ns(const struct timespec *t0, const struct timespec *t1, unsigned long calls)
+{
+    return ((t1->tv_sec - t0->tv_sec) * 1e9 + (t1->tv_nsec - t0->tv_nsec)) / calls;
+}
+
+static void bench_row(const char *name, unsigned long calls, double ns, double sprintf_ns)
+{
+    printf("%-20s %8lu %9.1f %11.1f\n", name, calls, ns, sprintf_ns);
+}
+
+int main(void)
+{
+    uint8 got[NUM_CONV_MAX_WIDTH + 1];
+    char expected[32];
+    unsigned long calls, wrong_old = 0;
+    struct timespec t0, t1;
+    volatile unsigned long sink = 0;
+    double ns, sprintf_ns;
+
+    /* Correctness */
+    for (unsigned value = 0; value <= 0xFF; value++)
+    {
+        Num_Conv_Uint8_To_String((uint8)value, got);
+        snprintf(expected, sizeof(expected), "%u", value);
+        bench_check("uint8", (char *)got, expected);
+    }
+    for (unsigned long value = 0; value <= 0xFFFFUL; value++)
+    {
+        Num_Conv_Uint16_To_String((uint16)value, got);
+        snprintf(expected, sizeof(expected), "%lu", value);
+        bench_check("uint16", (char *)got, expected);
+
+        /* The old path: "%d" with a 16-bit int */
+        char old[8];
+        snprintf(old, sizeof(old), "%d", (int)(short)value);
+        wrong_old += (0 != strcmp(old, expected));
+    }
+    for (unsigned long n = 0; n < BENCH_UINT32_VALUES; n++)
+    {
+        uint32 value = (n < 2) ? (n ? 0xFFFFFFFFUL : 0UL) : bench_uint32();
+        uint8 width = (uint8)(n % 13);
+
+        Num_Conv_Uint32_To_String(value, got);
+        snprintf(expected, sizeof(expected), "%lu", (unsigned long)value);
+        bench_check("uint32", (char *)got, expected);
+
+        Num_Conv_Uint32_To_String_Width(value, got, width, NUM_CONV_PAD_ZERO);
+        snprintf(expected, sizeof(expected), "%0*lu", width, (unsigned long)value);
+        bench_check("uint32 zero pad", (char *)got, expected);
+
+        Num_Conv_Uint32_To_String_Width(value, got, width, NUM_CONV_PAD_SPACE);
+        snprintf(expected, sizeof(expected), "%*lu", width, (unsigned long)value);
+        bench_check("uint32 space pad", (char *)got, expected);
+    }
+    for (unsigned long n = 0; n < BENCH_UINT32_VALUES; n++)
+    {
+        sint32 value = (n < 2) ? (n ? (sint32)0x7FFFFFFFL : (sint32)(-0x7FFFFFFFL - 1)) : (sint32)(int32_t)bench_uint32();
+        uint8 decimals = (uint8)(n % (NUM_CONV_MAX_DECIMALS + 1U));
+        uint8 width = (uint8)(n % 15);
+        uint8 pad = (n & 1) ? NUM_CONV_PAD_ZERO : NUM_CONV_PAD_SPACE;
+        long long scale = 1;
+        char digits[32];
+
+        if (n & 2)
+        {
+            value = -value;
+        }
+        for (uint8 i = 0; i < decimals; i++)
+        {
+            scale *= 10;
+        }
+        /* Reference: integer and fraction parts printed separately, then padded */
+        long long magnitude = (value < 0) ? -(long long)value : (long long)value;
+        if (decimals)
+        {
+            snprintf(digits, sizeof(digits), "%s%lld.%0*lld", (value < 0) ? "-" : "",
+                     magnitude / scale, decimals, magnitude % scale);
+        }
+        else
+        {
+            snprintf(digits, sizeof(digits), "%s%lld", (value < 0) ? "-" : "", magnitude);
+        }
+        int fill = width - (int)strlen(digits);
+        if (fill < 0)
+        {
+            fill = 0;
+        }
+        if (NUM_CONV_PAD_ZERO == pad)
+        {
+            int sign = (value < 0);
+            snprintf(expected, sizeof(expected), "%.*s%.*s%s", sign, digits, fill,
+                     "00000000000000000000", digits + sign);
+        }
+        else
+        {
+            snprintf(expected, sizeof(expected), "%*s", width, digits);
+        }
+        Num_Conv_Fixed_To_String(value, decimals, got, width, pad);
+        bench_check("fixed", (char *)got, expected);
+    }
+
+    /* Cost */
+    printf("%-20s %8s %9s %11s\n", "function", "calls", "ns/call", "sprintf_ns");
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (unsigned value = 0; value <= 0xFF; value++)
+    {
+        Num_Conv_Uint8_To_String((uint8)value, got);
+        sink += got[0];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    ns = bench_ns(&t0, &t1, 0x100);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (unsigned value = 0; value <= 0xFF; value++)
+    {
+        sprintf(expected, "%u", value);
+        sink += (unsigned char)expected[0];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    bench_row("uint8", 0x100, ns, bench_ns(&t0, &t1, 0x100));
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (unsigned long value = 0; value <= 0xFFFFUL; value++)
+    {
+        Num_Conv_Uint16_To_String((uint16)value, got);
+        sink += got[0];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    ns = bench_ns(&t0, &t1, 0x10000UL);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (unsigned long value = 0; value <= 0xFFFFUL; value++)
+    {
+        sprintf(expected, "%lu", value);
+        sink += (unsigned char)expected[0];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    bench_row("uint16", 0x10000UL, ns, bench_ns(&t0, &t1, 0x10000UL));
+
+    calls = BENCH_UINT32_VALUES;
+    bench_seed = 7;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (unsigned long n = 0; n < calls; n++)
+    {
+        Num_Conv_Uint32_To_String(bench_uint32(), got);
+        sink += got[0];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    ns = bench_ns(&t0, &t1, calls);
+    bench_seed = 7;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (unsigned long n = 0; n < calls; n++)
+    {
+        sprintf(expected, "%lu", (unsigned long)bench_uint32());
+        sink += (unsigned char)expected[0];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    sprintf_ns = bench_ns(&t0, &t1, calls);
+    bench_row("uint32", calls, ns, sprintf_ns);
+
+    /* Most subtraction steps: ten digits, nearly all of them 9 */
+    calls = BENCH_UINT32_VALUES;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (unsigned long n = 0; n < calls; n++)
+    {
+        Num_Conv_Uint32_To_String(3999999999UL, got);
+        sink += got[0];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    ns = bench_ns(&t0, &t1, calls);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (unsigned long n = 0; n < calls; n++)
+    {
+        sprintf(expected, "%lu", 3999999999UL);
+        sink += (unsigned char)expected[0];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    bench_row("uint32 \"3999999999\"", calls, ns, bench_ns(&t0, &t1, calls));
+
+    printf("host times only, no PIC18 cycle count is measured for either column\n");
+    printf("old \"%%d\" path wrong for %lu of 65536 uint16 values\n", wrong_old);
+    printf("%s: %lu mismatches\n", bench_errors ? "FAIL" : "PASS", bench_errors);
+    return bench_errors ? 1 : 0;
+}
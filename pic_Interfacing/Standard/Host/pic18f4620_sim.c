@@ -0,0 +1,473 @@
+/*
+ * File:   pic18f4620_sim.c
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+//==================================================
+// Includes
+//==================================================
+#include "pic18f4620_sim.h"
+#include <string.h>
+
+//==================================================
+// Macro Declarations
+//==================================================
+#define SFR_BIT(addr, bit)          ((pic18_sim_sfr[(addr)] >> (bit)) & 1U)
+#define SFR_SET(addr, bit)          (pic18_sim_sfr[(addr)] |= (uint8_t)(1U << (bit)))
+#define SFR_CLR(addr, bit)          (pic18_sim_sfr[(addr)] &= (uint8_t)~(1U << (bit)))
+#define ROSE(old, new, bit)         ((!(((old) >> (bit)) & 1U)) && (((new) >> (bit)) & 1U))
+
+/* Bit positions used by the built-in models */
+#define PIR1_SSPIF      3U
+#define PIR1_TXIF       4U
+#define PIR1_RCIF       5U
+#define PIR1_ADIF       6U
+#define PIR2_EEIF       4U
+#define EECON1_RD       0U
+#define EECON1_WR       1U
+#define EECON1_WREN     2U
+#define EECON1_WRERR    3U
+#define EECON1_CFGS     6U
+#define EECON1_EEPGD    7U
+#define RCSTA_OERR      1U
+#define RCSTA_CREN      4U
+#define TXSTA_TRMT      1U
+#define TXSTA_TXEN      5U
+#define ADCON0_GODONE   1U
+#define ADCON2_ADFM     7U
+#define SSPCON2_SEN     0U
+#define SSPCON2_RSEN    1U
+#define SSPCON2_PEN     2U
+#define SSPCON2_RCEN    3U
+#define SSPCON2_ACKEN   4U
+#define SSPCON2_ACKSTAT 6U
+#define SSPSTAT_BF      0U
+#define SSPSTAT_S       3U
+#define SSPSTAT_P       4U
+
+#define SSPM_I2C_MASTER 0x08U
+#define SSPM_SPI_LAST   0x05U
+
+//==================================================
+// Statics
+//==================================================
+volatile uint8_t pic18_sim_sfr[PIC18_SIM_SFR_SIZE];
+
+static pic18_sim_read_hook_t read_hooks[PIC18_SIM_SFR_SIZE];
+static pic18_sim_write_hook_t write_hooks[PIC18_SIM_SFR_SIZE];
+
+static uint8_t access_pending = 0;
+static uint16_t access_addr = 0;
+static uint8_t access_old = 0;
+static uint32_t access_count = 0;
+static uint32_t delay_count = 0;
+
+static uint8_t eeprom_data[PIC18_SIM_EEPROM_SIZE];
+static uint8_t eeprom_unlock = 0;
+static uint16_t adc_inputs[PIC18_SIM_ADC_CHANNELS];
+
+static uint8_t uart_rx_fifo[PIC18_SIM_UART_FIFO_SIZE];
+static uint16_t uart_rx_head = 0, uart_rx_tail = 0;
+static uint8_t uart_tx_fifo[PIC18_SIM_UART_FIFO_SIZE];
+static uint16_t uart_tx_head = 0, uart_tx_tail = 0;
+
+static uint8_t mssp_rx_full = 0;
+static uint8_t mssp_buffer_read = 0;
+static pic18_sim_mssp_bus_t mssp_bus;
+
+static void default_write_hook(uint16_t addr, uint8_t old_value, uint8_t new_value);
+static void mssp_buffer_access(void);
+static uint8_t bus_spi_loopback(uint8_t out);
+static uint8_t bus_i2c_ack(uint8_t data);
+static uint8_t bus_i2c_idle(void);
+
+//==================================================
+// Function Definitions
+//==================================================
+volatile void *pic18_sim_access(uint16_t addr)
+{
+    pic18_sim_sync();
+    access_count++;
+    /* Built-in models run ahead of the harness read hooks, which stay free for it */
+    if ((SSPBUF_ADDR == addr) && (default_write_hook == write_hooks[addr])) {
+        mssp_buffer_access();
+    }
+    if (NULL != read_hooks[addr]) {
+        read_hooks[addr](addr);
+    }
+    access_pending = 1;
+    access_addr = addr;
+    access_old = pic18_sim_sfr[addr];
+    return &pic18_sim_sfr[addr];
+}
+
+void pic18_sim_sync(void)
+{
+    if (access_pending) {
+        access_pending = 0;
+        if (NULL != write_hooks[access_addr]) {
+            write_hooks[access_addr](access_addr, access_old, pic18_sim_sfr[access_addr]);
+        }
+    }
+}
+
+void pic18_sim_delay_cycles(uint32_t cycles)
+{
+    pic18_sim_sync();
+    delay_count += cycles;
+}
+
+void pic18_sim_reset(void)
+{
+    uint16_t addr;
+
+    memset((void *)pic18_sim_sfr, 0, sizeof(pic18_sim_sfr));
+    for (addr = 0; addr < PIC18_SIM_SFR_SIZE; addr++) {
+        read_hooks[addr] = NULL;
+        write_hooks[addr] = NULL;
+    }
+    write_hooks[EECON1_ADDR] = default_write_hook;
+    write_hooks[EECON2_ADDR] = default_write_hook;
+    write_hooks[TXSTA_ADDR] = default_write_hook;
+    write_hooks[TXREG_ADDR] = default_write_hook;
+    write_hooks[RCSTA_ADDR] = default_write_hook;
+    write_hooks[RCREG_ADDR] = default_write_hook;
+    write_hooks[ADCON0_ADDR] = default_write_hook;
+    write_hooks[SSPCON2_ADDR] = default_write_hook;
+    write_hooks[SSPBUF_ADDR] = default_write_hook;
+
+    /* Power-on reset values (DS39626E, Table 4-4) */
+    pic18_sim_sfr[TRISA_ADDR] = 0xFF;
+    pic18_sim_sfr[TRISB_ADDR] = 0xFF;
+    pic18_sim_sfr[TRISC_ADDR] = 0xFF;
+    pic18_sim_sfr[TRISD_ADDR] = 0xFF;
+    pic18_sim_sfr[TRISE_ADDR] = 0x07;
+    pic18_sim_sfr[IPR1_ADDR] = 0xFF;
+    pic18_sim_sfr[IPR2_ADDR] = 0xDF;
+    pic18_sim_sfr[TXSTA_ADDR] = 0x02;
+    pic18_sim_sfr[BAUDCON_ADDR] = 0x40;
+    pic18_sim_sfr[PR2_ADDR] = 0xFF;
+    pic18_sim_sfr[RCON_ADDR] = 0x1C;
+    pic18_sim_sfr[T0CON_ADDR] = 0xFF;
+    pic18_sim_sfr[INTCON2_ADDR] = 0xF5;
+    pic18_sim_sfr[INTCON3_ADDR] = 0xC0;
+
+    access_pending = 0;
+    access_count = 0;
+    delay_count = 0;
+    eeprom_unlock = 0;
+    memset(eeprom_data, 0xFF, sizeof(eeprom_data));
+    memset(adc_inputs, 0, sizeof(adc_inputs));
+    uart_rx_head = uart_rx_tail = 0;
+    uart_tx_head = uart_tx_tail = 0;
+    mssp_rx_full = 0;
+    mssp_buffer_read = 0;
+    mssp_bus.spi_exchange = bus_spi_loopback;
+    mssp_bus.i2c_write = bus_i2c_ack;
+    mssp_bus.i2c_read = bus_i2c_idle;
+    mssp_bus.i2c_condition = NULL;
+}
+
+void pic18_sim_set_read_hook(uint16_t addr, pic18_sim_read_hook_t hook)
+{
+    if (addr < PIC18_SIM_SFR_SIZE) {
+        read_hooks[addr] = hook;
+    }
+}
+
+void pic18_sim_set_write_hook(uint16_t addr, pic18_sim_write_hook_t hook)
+{
+    if (addr < PIC18_SIM_SFR_SIZE) {
+        write_hooks[addr] = hook;
+    }
+}
+
+uint32_t pic18_sim_access_count(void)
+{
+    return access_count;
+}
+
+uint32_t pic18_sim_delay_count(void)
+{
+    return delay_count;
+}
+
+void pic18_sim_adc_set_input(uint8_t channel, uint16_t value)
+{
+    if (channel < PIC18_SIM_ADC_CHANNELS) {
+        adc_inputs[channel] = (uint16_t)(value & 0x3FFU);
+    }
+}
+
+void pic18_sim_uart_rx_push(uint8_t data)
+{
+    pic18_sim_sync();
+    if (!SFR_BIT(RCSTA_ADDR, RCSTA_CREN)) {
+        return;
+    }
+    if (!SFR_BIT(PIR1_ADDR, PIR1_RCIF)) {
+        pic18_sim_sfr[RCREG_ADDR] = data;
+        SFR_SET(PIR1_ADDR, PIR1_RCIF);
+    }
+    else if ((uint16_t)(uart_rx_head - uart_rx_tail) < 1U) {
+        /* One byte waiting behind RCREG models the second FIFO stage */
+        uart_rx_fifo[uart_rx_head++ % PIC18_SIM_UART_FIFO_SIZE] = data;
+    }
+    else {
+        SFR_SET(RCSTA_ADDR, RCSTA_OERR);
+    }
+}
+
+uint16_t pic18_sim_uart_tx_pop(uint8_t *buffer, uint16_t maxlen)
+{
+    uint16_t count = 0;
+
+    pic18_sim_sync();
+    while ((count < maxlen) && (uart_tx_tail != uart_tx_head)) {
+        buffer[count++] = uart_tx_fifo[uart_tx_tail++ % PIC18_SIM_UART_FIFO_SIZE];
+    }
+    return count;
+}
+
+void pic18_sim_mssp_set_bus(const pic18_sim_mssp_bus_t *bus)
+{
+    mssp_bus.spi_exchange = ((NULL != bus) && (NULL != bus->spi_exchange)) ? bus->spi_exchange : bus_spi_loopback;
+    mssp_bus.i2c_write = ((NULL != bus) && (NULL != bus->i2c_write)) ? bus->i2c_write : bus_i2c_ack;
+    mssp_bus.i2c_read = ((NULL != bus) && (NULL != bus->i2c_read)) ? bus->i2c_read : bus_i2c_idle;
+    mssp_bus.i2c_condition = (NULL != bus) ? bus->i2c_condition : NULL;
+}
+
+uint8_t *pic18_sim_eeprom(void)
+{
+    return eeprom_data;
+}
+
+//==================================================
+// Built-in Peripheral Models
+//==================================================
+static uint8_t bus_spi_loopback(uint8_t out)
+{
+    return out;
+}
+
+static uint8_t bus_i2c_ack(uint8_t data)
+{
+    (void)data;
+    return 0;
+}
+
+static uint8_t bus_i2c_idle(void)
+{
+    return 0xFF;
+}
+
+static void i2c_condition_done(uint8_t cond)
+{
+    if (PIC18_SIM_I2C_STOP == cond) {
+        SFR_CLR(SSPSTAT_ADDR, SSPSTAT_S);
+        SFR_SET(SSPSTAT_ADDR, SSPSTAT_P);
+    }
+    else {
+        SFR_SET(SSPSTAT_ADDR, SSPSTAT_S);
+        SFR_CLR(SSPSTAT_ADDR, SSPSTAT_P);
+    }
+    if (NULL != mssp_bus.i2c_condition) {
+        mssp_bus.i2c_condition(cond);
+    }
+    SFR_SET(PIR1_ADDR, PIR1_SSPIF);
+}
+
+static void eeprom_model(uint16_t addr, uint8_t old_value, uint8_t new_value)
+{
+    uint16_t ee_addr = (uint16_t)(((pic18_sim_sfr[EEADRH_ADDR] & 0x03U) << 8) | pic18_sim_sfr[EEADR_ADDR]);
+    uint8_t data_space = (uint8_t)(!((new_value >> EECON1_EEPGD) & 1U) && !((new_value >> EECON1_CFGS) & 1U));
+
+    if (EECON2_ADDR == addr) {
+        if (0x55U == new_value) {
+            eeprom_unlock = 1;
+        }
+        else if ((0xAAU == new_value) && (1U == eeprom_unlock)) {
+            eeprom_unlock = 2;
+        }
+        else {
+            eeprom_unlock = 0;
+        }
+        return;
+    }
+    if (ROSE(old_value, new_value, EECON1_RD)) {
+        if (data_space) {
+            pic18_sim_sfr[EEDATA_ADDR] = eeprom_data[ee_addr];
+        }
+        SFR_CLR(EECON1_ADDR, EECON1_RD);
+    }
+    if (ROSE(old_value, new_value, EECON1_WR)) {
+        if ((2U == eeprom_unlock) && ((new_value >> EECON1_WREN) & 1U) && data_space) {
+            eeprom_data[ee_addr] = pic18_sim_sfr[EEDATA_ADDR];
+            SFR_SET(PIR2_ADDR, PIR2_EEIF);
+        }
+        else {
+            SFR_SET(EECON1_ADDR, EECON1_WRERR);
+        }
+        SFR_CLR(EECON1_ADDR, EECON1_WR);
+        eeprom_unlock = 0;
+    }
+}
+
+static void uart_model(uint16_t addr, uint8_t old_value, uint8_t new_value)
+{
+    switch (addr) {
+        case TXSTA_ADDR:
+            SFR_SET(TXSTA_ADDR, TXSTA_TRMT);
+            if ((new_value >> TXSTA_TXEN) & 1U) {
+                SFR_SET(PIR1_ADDR, PIR1_TXIF);
+            }
+            else {
+                SFR_CLR(PIR1_ADDR, PIR1_TXIF);
+            }
+            break;
+        case TXREG_ADDR:
+            /* TXREG is write only: every access is a byte handed to the shifter */
+            if ((uint16_t)(uart_tx_head - uart_tx_tail) < PIC18_SIM_UART_FIFO_SIZE) {
+                uart_tx_fifo[uart_tx_head++ % PIC18_SIM_UART_FIFO_SIZE] = new_value;
+            }
+            SFR_SET(TXSTA_ADDR, TXSTA_TRMT);
+            SFR_SET(PIR1_ADDR, PIR1_TXIF);
+            break;
+        case RCSTA_ADDR:
+            if (!((new_value >> RCSTA_CREN) & 1U)) {
+                SFR_CLR(RCSTA_ADDR, RCSTA_OERR);
+            }
+            break;
+        case RCREG_ADDR:
+            /* RCREG is read only: every access pops the FIFO */
+            if (uart_rx_tail != uart_rx_head) {
+                pic18_sim_sfr[RCREG_ADDR] = uart_rx_fifo[uart_rx_tail++ % PIC18_SIM_UART_FIFO_SIZE];
+            }
+            else {
+                SFR_CLR(PIR1_ADDR, PIR1_RCIF);
+            }
+            break;
+        default:
+            break;
+    }
+    (void)old_value;
+}
+
+static void adc_model(uint8_t old_value, uint8_t new_value)
+{
+    uint8_t channel = (uint8_t)((new_value >> 2) & 0x0FU);
+    uint16_t result = (channel < PIC18_SIM_ADC_CHANNELS) ? adc_inputs[channel] : 0U;
+
+    if (ROSE(old_value, new_value, ADCON0_GODONE)) {
+        if (SFR_BIT(ADCON2_ADDR, ADCON2_ADFM)) {
+            pic18_sim_sfr[ADRESH_ADDR] = (uint8_t)(result >> 8);
+            pic18_sim_sfr[ADRESL_ADDR] = (uint8_t)result;
+        }
+        else {
+            pic18_sim_sfr[ADRESH_ADDR] = (uint8_t)(result >> 2);
+            pic18_sim_sfr[ADRESL_ADDR] = (uint8_t)(result << 6);
+        }
+        SFR_CLR(ADCON0_ADDR, ADCON0_GODONE);
+        SFR_SET(PIR1_ADDR, PIR1_ADIF);
+    }
+}
+
+static void mssp_model(uint16_t addr, uint8_t old_value, uint8_t new_value)
+{
+    uint8_t sspm = (uint8_t)(pic18_sim_sfr[SSPCON1_ADDR] & 0x0FU);
+
+    if (SSPCON2_ADDR == addr) {
+        if (ROSE(old_value, new_value, SSPCON2_SEN)) {
+            SFR_CLR(SSPCON2_ADDR, SSPCON2_SEN);
+            i2c_condition_done(PIC18_SIM_I2C_START);
+        }
+        if (ROSE(old_value, new_value, SSPCON2_RSEN)) {
+            SFR_CLR(SSPCON2_ADDR, SSPCON2_RSEN);
+            i2c_condition_done(PIC18_SIM_I2C_RESTART);
+        }
+        if (ROSE(old_value, new_value, SSPCON2_PEN)) {
+            SFR_CLR(SSPCON2_ADDR, SSPCON2_PEN);
+            i2c_condition_done(PIC18_SIM_I2C_STOP);
+        }
+        if (ROSE(old_value, new_value, SSPCON2_RCEN)) {
+            pic18_sim_sfr[SSPBUF_ADDR] = mssp_bus.i2c_read();
+            mssp_rx_full = 1;
+            SFR_CLR(SSPCON2_ADDR, SSPCON2_RCEN);
+            SFR_SET(SSPSTAT_ADDR, SSPSTAT_BF);
+            SFR_SET(PIR1_ADDR, PIR1_SSPIF);
+        }
+        if (ROSE(old_value, new_value, SSPCON2_ACKEN)) {
+            SFR_CLR(SSPCON2_ADDR, SSPCON2_ACKEN);
+            SFR_SET(PIR1_ADDR, PIR1_SSPIF);
+        }
+        return;
+    }
+
+    /* SSPBUF: mssp_buffer_access already took a read, only a write is left to do */
+    if (mssp_buffer_read && (old_value == new_value)) {
+        /* Nothing */
+    }
+    else if (sspm <= SSPM_SPI_LAST) {
+        pic18_sim_sfr[SSPBUF_ADDR] = mssp_bus.spi_exchange(new_value);
+        mssp_rx_full = 1;
+        SFR_SET(SSPSTAT_ADDR, SSPSTAT_BF);
+        SFR_SET(PIR1_ADDR, PIR1_SSPIF);
+    }
+    else if (SSPM_I2C_MASTER == sspm) {
+        mssp_rx_full = 0;
+        if (mssp_bus.i2c_write(new_value)) {
+            SFR_SET(SSPCON2_ADDR, SSPCON2_ACKSTAT);
+        }
+        else {
+            SFR_CLR(SSPCON2_ADDR, SSPCON2_ACKSTAT);
+        }
+        SFR_CLR(SSPSTAT_ADDR, SSPSTAT_BF);
+        SFR_SET(PIR1_ADDR, PIR1_SSPIF);
+    }
+    else {
+        /* Slave modes are driven by the harness writing the registers directly */
+    }
+}
+
+/*
+ * Runs when the CPU touches SSPBUF, before it reads or writes it. An access
+ * made while a received byte is pending is the driver taking that byte, it
+ * clears BF right away as the target does. The drivers always read SSPBUF
+ * before loading it again, so the only write such an access can carry is one
+ * that changes the register, mssp_model starts that one on the settle.
+ */
+static void mssp_buffer_access(void)
+{
+    mssp_buffer_read = mssp_rx_full;
+    if (mssp_rx_full) {
+        mssp_rx_full = 0;
+        SFR_CLR(SSPSTAT_ADDR, SSPSTAT_BF);
+    }
+}
+
+static void default_write_hook(uint16_t addr, uint8_t old_value, uint8_t new_value)
+{
+    switch (addr) {
+        case EECON1_ADDR:
+        case EECON2_ADDR:
+            eeprom_model(addr, old_value, new_value);
+            break;
+        case TXSTA_ADDR:
+        case TXREG_ADDR:
+        case RCSTA_ADDR:
+        case RCREG_ADDR:
+            uart_model(addr, old_value, new_value);
+            break;
+        case ADCON0_ADDR:
+            adc_model(old_value, new_value);
+            break;
+        case SSPCON2_ADDR:
+        case SSPBUF_ADDR:
+            mssp_model(addr, old_value, new_value);
+            break;
+        default:
+            break;
+    }
+}
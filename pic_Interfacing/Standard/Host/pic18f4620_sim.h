@@ -0,0 +1,93 @@
+/*
+ * File:   pic18f4620_sim.h
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef PIC18F4620_SIM_H
+#define PIC18F4620_SIM_H
+
+//==================================================
+// Includes
+//==================================================
+#include <xc.h>
+
+//==================================================
+// Macro Declarations
+//==================================================
+#define PIC18_SIM_EEPROM_SIZE       1024U
+#define PIC18_SIM_ADC_CHANNELS      13U
+#define PIC18_SIM_UART_FIFO_SIZE    4096U
+
+#define PIC18_SIM_I2C_START         0x00U
+#define PIC18_SIM_I2C_RESTART       0x01U
+#define PIC18_SIM_I2C_STOP          0x02U
+
+//==================================================
+// Data Types Declarations
+//==================================================
+/**
+ * @brief Called before the CPU touches a register, so a peripheral model
+ *        can refresh the value the driver is about to see.
+ */
+typedef void (*pic18_sim_read_hook_t)(uint16_t addr);
+
+/**
+ * @brief Called once an access has settled, with the register content
+ *        before and after it. RCREG also applies its read side effect here,
+ *        SSPBUF takes its read when accessed, ahead of any read hook.
+ */
+typedef void (*pic18_sim_write_hook_t)(uint16_t addr, uint8_t old_value, uint8_t new_value);
+
+/**
+ * @brief Behaviour of the devices hanging on the MSSP pins.
+ */
+typedef struct {
+    uint8_t (*spi_exchange)(uint8_t out);   /* returns the byte shifted in     */
+    uint8_t (*i2c_write)(uint8_t data);     /* returns 0 for ACK, 1 for NACK    */
+    uint8_t (*i2c_read)(void);              /* returns the byte the slave drives */
+    void (*i2c_condition)(uint8_t cond);    /* START, RESTART or STOP           */
+} pic18_sim_mssp_bus_t;
+
+//==================================================
+// Functions Declarations
+//==================================================
+/* Entry point generated by interrupt_manager.c (the __interrupt() qualifier is dropped on host) */
+void InterruptManager(void);
+
+/**
+ * @brief Restores the power-on reset value of every SFR, clears the hooks
+ *        back to the built-in peripheral models and zeroes the counters.
+ */
+void pic18_sim_reset(void);
+
+/**
+ * @brief Settles the last hooked access so its write hook runs. Call it
+ *        before inspecting registers from the harness.
+ */
+void pic18_sim_sync(void);
+
+void pic18_sim_set_read_hook(uint16_t addr, pic18_sim_read_hook_t hook);
+void pic18_sim_set_write_hook(uint16_t addr, pic18_sim_write_hook_t hook);
+
+/**
+ * @brief Number of hooked SFR accesses since reset. Every hooked access is
+ *        one MOVF/MOVWF/BSF/BCF/BTFSS class instruction on the target, so
+ *        this is a stable cost metric for driver hot paths.
+ */
+uint32_t pic18_sim_access_count(void);
+
+/**
+ * @brief Instruction cycles burnt in __delay_us/__delay_ms/NOP since reset.
+ */
+uint32_t pic18_sim_delay_count(void);
+
+/* Peripheral stimulus */
+void pic18_sim_adc_set_input(uint8_t channel, uint16_t value);
+void pic18_sim_uart_rx_push(uint8_t data);
+uint16_t pic18_sim_uart_tx_pop(uint8_t *buffer, uint16_t maxlen);
+void pic18_sim_mssp_set_bus(const pic18_sim_mssp_bus_t *bus);
+uint8_t *pic18_sim_eeprom(void);
+
+#endif /* PIC18F4620_SIM_H */
@@ -0,0 +1,328 @@
+/*
+ * File:   spi_flash_sim.c
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+//==================================================
+// Includes
+//==================================================
+#include "spi_flash_sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//==================================================
+// Macro Declarations
+//==================================================
+#define CMD_WRITE_STATUS        0x01U
+#define CMD_PAGE_PROGRAM        0x02U
+#define CMD_READ                0x03U
+#define CMD_WRITE_DISABLE       0x04U
+#define CMD_READ_STATUS         0x05U
+#define CMD_WRITE_ENABLE        0x06U
+#define CMD_FAST_READ           0x0BU
+#define CMD_SECTOR_ERASE        0x20U
+#define CMD_CHIP_ERASE          0xC7U
+#define CMD_JEDEC_ID            0x9FU
+#define CMD_RELEASE_POWER_DOWN  0xABU
+#define CMD_POWER_DOWN          0xB9U
+
+#define STATUS_BUSY             0x01U
+#define STATUS_WEL              0x02U
+
+//==================================================
+// Statics
+//==================================================
+static FILE *flash_file = NULL;
+static uint8_t *flash_mem = NULL;
+static uint32_t flash_size = 0;
+static uint8_t flash_capacity_code = 0;
+static uint16_t cs_lat_addr = LATA_ADDR;
+static uint8_t cs_mask = 0;
+
+static uint8_t selected = 0;            /* CS seen low since it was last seen high */
+static uint32_t frame_pos = 0;          /* bytes of the current frame so far      */
+static uint8_t command = 0;
+static uint32_t address = 0;
+static uint8_t status = 0;
+static uint8_t powered_down = 0;
+static uint16_t busy_polls = 0;
+static uint16_t program_polls = 0;
+static uint16_t erase_polls = 0;
+static uint8_t page_latch[SPI_FLASH_SIM_PAGE_SIZE];
+static uint32_t page_latched = 0;
+
+static uint32_t program_count = 0;
+static uint32_t erase_count = 0;
+static uint32_t byte_count = 0;
+
+static uint8_t flash_exchange(uint8_t out);
+static void flash_sample_cs(uint16_t addr);
+static void flash_end_frame(void);
+static void flash_write_through(uint32_t start, uint32_t len);
+
+//==================================================
+// Function Definitions
+//==================================================
+int spi_flash_sim_open(const char *path, uint32_t size, uint8_t cs_port, uint8_t cs_pin)
+{
+    long length;
+    uint8_t code = 16;
+
+    while ((code <= 24) && ((1UL << code) != size)) {
+        code++;
+    }
+    if ((NULL == path) || (code > 24) || (cs_port > 4) || (cs_pin > 7)) {
+        return -1;
+    }
+    spi_flash_sim_close();
+
+    flash_mem = malloc(size);
+    flash_file = fopen(path, "r+b");
+    if (NULL == flash_file) {
+        flash_file = fopen(path, "w+b");
+    }
+    if ((NULL == flash_mem) || (NULL == flash_file)) {
+        spi_flash_sim_close();
+        return -1;
+    }
+    /* Whatever the file holds is the chip content, the rest reads erased */
+    memset(flash_mem, 0xFF, size);
+    fseek(flash_file, 0, SEEK_END);
+    length = ftell(flash_file);
+    rewind(flash_file);
+    if ((uint32_t)length > size) {
+        length = (long)size;
+    }
+    if (fread(flash_mem, 1, (size_t)length, flash_file) != (size_t)length) {
+        spi_flash_sim_close();
+        return -1;
+    }
+    flash_size = size;
+    flash_capacity_code = code;
+    if ((uint32_t)length < size) {
+        flash_write_through((uint32_t)length, size - (uint32_t)length);
+    }
+
+    cs_lat_addr = (uint16_t)(LATA_ADDR + cs_port);
+    cs_mask = (uint8_t)(1U << cs_pin);
+    selected = 0;
+    status = 0;
+    powered_down = 0;
+    busy_polls = 0;
+    program_count = erase_count = byte_count = 0;
+
+    pic18_sim_mssp_set_bus(&(pic18_sim_mssp_bus_t){ .spi_exchange = flash_exchange });
+    pic18_sim_set_read_hook(SSPCON1_ADDR, flash_sample_cs);
+    pic18_sim_set_read_hook(SSPSTAT_ADDR, flash_sample_cs);
+    pic18_sim_set_read_hook(SSPBUF_ADDR, flash_sample_cs);
+    return 0;
+}
+
+void spi_flash_sim_close(void)
+{
+    if (NULL != flash_file) {
+        pic18_sim_mssp_set_bus(NULL);
+        pic18_sim_set_read_hook(SSPCON1_ADDR, NULL);
+        pic18_sim_set_read_hook(SSPSTAT_ADDR, NULL);
+        pic18_sim_set_read_hook(SSPBUF_ADDR, NULL);
+        fclose(flash_file);
+        flash_file = NULL;
+    }
+    free(flash_mem);
+    flash_mem = NULL;
+    flash_size = 0;
+}
+
+void spi_flash_sim_set_busy(uint16_t program, uint16_t erase)
+{
+    program_polls = program;
+    erase_polls = erase;
+}
+
+uint8_t *spi_flash_sim_memory(void)
+{
+    return flash_mem;
+}
+
+uint32_t spi_flash_sim_size(void)
+{
+    return flash_size;
+}
+
+uint32_t spi_flash_sim_program_count(void)
+{
+    return program_count;
+}
+
+uint32_t spi_flash_sim_erase_count(void)
+{
+    return erase_count;
+}
+
+uint32_t spi_flash_sim_byte_count(void)
+{
+    return byte_count;
+}
+
+//==================================================
+// Chip Model
+//==================================================
+static uint8_t flash_exchange(uint8_t out)
+{
+    uint8_t in = 0xFF;
+
+    if (pic18_sim_sfr[cs_lat_addr] & cs_mask) {
+        /* Not selected, SDO stays released */
+        flash_end_frame();
+        return in;
+    }
+    if (!selected) {
+        selected = 1;
+        frame_pos = 0;
+        page_latched = 0;
+    }
+    byte_count++;
+
+    if (0 == frame_pos) {
+        command = out;
+    }
+    else if (powered_down || ((status & STATUS_BUSY) && (CMD_READ_STATUS != command))) {
+        /* Everything but the wake up (and the status while busy) is ignored */
+    }
+    else {
+        switch (command) {
+            case CMD_READ_STATUS:
+                in = status;
+                if (busy_polls && (0 == --busy_polls)) {
+                    status &= (uint8_t)~(STATUS_BUSY | STATUS_WEL);
+                }
+                break;
+            case CMD_JEDEC_ID:
+                in = (1 == frame_pos) ? SPI_FLASH_SIM_MANUFACTURER :
+                     (2 == frame_pos) ? SPI_FLASH_SIM_MEMORY_TYPE :
+                     (3 == frame_pos) ? flash_capacity_code : 0xFF;
+                break;
+            case CMD_READ:
+            case CMD_FAST_READ:
+            case CMD_PAGE_PROGRAM:
+            case CMD_SECTOR_ERASE:
+                if (frame_pos <= 3) {
+                    address = (address << 8) | out;
+                    if (3 == frame_pos) {
+                        address &= flash_size - 1U;
+                    }
+                }
+                else if ((CMD_READ == command) || ((CMD_FAST_READ == command) && (frame_pos > 4))) {
+                    in = flash_mem[address];
+                    address = (address + 1U) & (flash_size - 1U);
+                }
+                else if (CMD_PAGE_PROGRAM == command) {
+                    /* Past the end of the page the address wraps to its start */
+                    if (0 == page_latched) {
+                        memset(page_latch, 0xFF, sizeof(page_latch));
+                    }
+                    page_latch[(address + page_latched) % SPI_FLASH_SIM_PAGE_SIZE] = out;
+                    page_latched++;
+                }
+                else {
+                    /* Fast read dummy byte, or bytes past an erase address */
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    frame_pos++;
+    return in;
+}
+
+static void flash_sample_cs(uint16_t addr)
+{
+    (void)addr;
+    if (pic18_sim_sfr[cs_lat_addr] & cs_mask) {
+        flash_end_frame();
+    }
+}
+
+/* Commands that change the array or the status act on CS going high */
+static void flash_end_frame(void)
+{
+    uint32_t base;
+    uint32_t index;
+
+    if (!selected) {
+        return;
+    }
+    selected = 0;
+    if (CMD_RELEASE_POWER_DOWN == command) {
+        powered_down = 0;
+        return;
+    }
+    if (powered_down || (status & STATUS_BUSY)) {
+        return;
+    }
+    switch (command) {
+        case CMD_WRITE_ENABLE:
+            status |= STATUS_WEL;
+            break;
+        case CMD_WRITE_DISABLE:
+            status &= (uint8_t)~STATUS_WEL;
+            break;
+        case CMD_POWER_DOWN:
+            powered_down = 1;
+            break;
+        case CMD_PAGE_PROGRAM:
+            if ((status & STATUS_WEL) && (frame_pos > 4)) {
+                /* Programming only clears bits */
+                base = address & ~(uint32_t)(SPI_FLASH_SIM_PAGE_SIZE - 1U);
+                for (index = 0; index < SPI_FLASH_SIM_PAGE_SIZE; index++) {
+                    flash_mem[base + index] &= page_latch[index];
+                }
+                flash_write_through(base, SPI_FLASH_SIM_PAGE_SIZE);
+                program_count++;
+                busy_polls = program_polls;
+            }
+            status &= (uint8_t)~STATUS_WEL;
+            break;
+        case CMD_SECTOR_ERASE:
+            if ((status & STATUS_WEL) && (frame_pos >= 4)) {
+                base = address & ~(uint32_t)(SPI_FLASH_SIM_SECTOR_SIZE - 1U);
+                memset(&flash_mem[base], 0xFF, SPI_FLASH_SIM_SECTOR_SIZE);
+                flash_write_through(base, SPI_FLASH_SIM_SECTOR_SIZE);
+                erase_count++;
+                busy_polls = erase_polls;
+            }
+            status &= (uint8_t)~STATUS_WEL;
+            break;
+        case CMD_CHIP_ERASE:
+            if (status & STATUS_WEL) {
+                memset(flash_mem, 0xFF, flash_size);
+                flash_write_through(0, flash_size);
+                erase_count++;
+                busy_polls = erase_polls;
+            }
+            status &= (uint8_t)~STATUS_WEL;
+            break;
+        case CMD_WRITE_STATUS:
+            status &= (uint8_t)~STATUS_WEL;
+            break;
+        default:
+            break;
+    }
+    if (busy_polls) {
+        /* WEL stays set until the operation is done, as on the real parts */
+        status |= (uint8_t)(STATUS_BUSY | STATUS_WEL);
+    }
+}
+
+static void flash_write_through(uint32_t start, uint32_t len)
+{
+    if ((NULL != flash_file) && (0 == fseek(flash_file, (long)start, SEEK_SET))) {
+        if (fwrite(&flash_mem[start], 1, len, flash_file) == len) {
+            fflush(flash_file);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * File:   spi_flash_sim.h
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef SPI_FLASH_SIM_H
+#define SPI_FLASH_SIM_H
+
+//==================================================
+// Includes
+//==================================================
+#include "pic18f4620_sim.h"
+
+//==================================================
+// Macro Declarations
+//==================================================
+/* JEDEC ID reported by the emulated chip, a Winbond W25Q part */
+#define SPI_FLASH_SIM_MANUFACTURER  0xEFU
+#define SPI_FLASH_SIM_MEMORY_TYPE   0x40U
+
+#define SPI_FLASH_SIM_PAGE_SIZE     256U
+#define SPI_FLASH_SIM_SECTOR_SIZE   4096U
+
+//==================================================
+// Functions Declarations
+//==================================================
+/**
+ * @brief Hangs a 25-series NOR flash on the simulated MSSP, backed by a file
+ *        so its content survives from one harness run to the next.
+ *
+ * A missing or short file is extended with erased (0xFF) bytes. Programs and
+ * erases are written through to the file as they complete. Call it after
+ * pic18_sim_reset(), it takes over the SPI side of the MSSP bus.
+ *
+ * CS lives in a LAT register, plain memory the simulator can't hook, so the
+ * emulator samples it on every SSPCON1, SSPSTAT and SSPBUF access (read hooks
+ * on those three) and on every exchanged byte. A frame ends once CS is seen
+ * high. The SPI bus manager reads SSPCON1 and SSPSTAT before it lowers a CS,
+ * which is what makes back to back frames on the same device visible.
+ *
+ * @param path Backing file, created if missing.
+ * @param size Chip size in bytes, a power of two from 64 KB to 16 MB.
+ * @param cs_port Port of the CS pin, 0 for PORTA to 4 for PORTE.
+ * @param cs_pin Bit of the CS pin, 0 to 7.
+ * @return 0 on success, -1 on a bad argument or a file error.
+ */
+int spi_flash_sim_open(const char *path, uint32_t size, uint8_t cs_port, uint8_t cs_pin);
+
+/**
+ * @brief Flushes and closes the backing file and puts the loopback bus back.
+ */
+void spi_flash_sim_close(void);
+
+/**
+ * @brief Number of status reads that still see the busy bit after a page
+ *        program and after a sector erase, 0 for instant completion.
+ */
+void spi_flash_sim_set_busy(uint16_t program_polls, uint16_t erase_polls);
+
+/* The emulated array, spi_flash_sim_size() bytes */
+uint8_t *spi_flash_sim_memory(void);
+uint32_t spi_flash_sim_size(void);
+
+/* Commands executed since open */
+uint32_t spi_flash_sim_program_count(void);
+uint32_t spi_flash_sim_erase_count(void);
+
+/* Bytes exchanged with CS low since open */
+uint32_t spi_flash_sim_byte_count(void);
+
+#endif /* SPI_FLASH_SIM_H */
@@ -0,0 +1,407 @@
+/*
+ * File:   xc.h
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ *
+ * Host replacement for the XC8 <xc.h> of the PIC18F4620. It is picked up
+ * instead of the compiler header when building with -IHost under gcc, and
+ * maps every SFR used by the drivers onto the simulated register file in
+ * pic18f4620_sim.c.
+ *
+ * PORTx/LATx/TRISx byte names are plain memory so their addresses stay
+ * constant (gpio.c keeps them in static tables). Every other register and
+ * every xxxbits view goes through pic18_sim_access() so the simulator can
+ * run its per-register read/write hooks around the access.
+ */
+
+#ifndef HOST_XC_H
+#define HOST_XC_H
+
+//==================================================
+// Includes
+//==================================================
+#include <stdint.h>
+
+//==================================================
+// Macro Declarations
+//==================================================
+#define __XC8           1
+#define _PIC18          1
+#define __18F4620       1
+
+/* Lets the shared headers tell the host build from XC8 */
+#define PIC18_SIM_HOST  1
+
+#define PIC18_SIM_SFR_SIZE      0x1000U
+
+/* Special Function Register addresses (DS39626E, Table 5-1) */
+#define PORTA_ADDR      0xF80U
+#define PORTB_ADDR      0xF81U
+#define PORTC_ADDR      0xF82U
+#define PORTD_ADDR      0xF83U
+#define PORTE_ADDR      0xF84U
+#define LATA_ADDR       0xF89U
+#define LATB_ADDR       0xF8AU
+#define LATC_ADDR       0xF8BU
+#define LATD_ADDR       0xF8CU
+#define LATE_ADDR       0xF8DU
+#define TRISA_ADDR      0xF92U
+#define TRISB_ADDR      0xF93U
+#define TRISC_ADDR      0xF94U
+#define TRISD_ADDR      0xF95U
+#define TRISE_ADDR      0xF96U
+#define PIE1_ADDR       0xF9DU
+#define PIR1_ADDR       0xF9EU
+#define IPR1_ADDR       0xF9FU
+#define PIE2_ADDR       0xFA0U
+#define PIR2_ADDR       0xFA1U
+#define IPR2_ADDR       0xFA2U
+#define EECON1_ADDR     0xFA6U
+#define EECON2_ADDR     0xFA7U
+#define EEDATA_ADDR     0xFA8U
+#define EEADR_ADDR      0xFA9U
+#define EEADRH_ADDR     0xFAAU
+#define RCSTA_ADDR      0xFABU
+#define TXSTA_ADDR      0xFACU
+#define TXREG_ADDR      0xFADU
+#define RCREG_ADDR      0xFAEU
+#define SPBRG_ADDR      0xFAFU
+#define SPBRGH_ADDR     0xFB0U
+#define T3CON_ADDR      0xFB1U
+#define TMR3L_ADDR      0xFB2U
+#define TMR3H_ADDR      0xFB3U
+#define BAUDCON_ADDR    0xFB8U
+#define CCP2CON_ADDR    0xFBAU
+#define CCPR2L_ADDR     0xFBBU
+#define CCPR2H_ADDR     0xFBCU
+#define CCP1CON_ADDR    0xFBDU
+#define CCPR1L_ADDR     0xFBEU
+#define CCPR1H_ADDR     0xFBFU
+#define ADCON2_ADDR     0xFC0U
+#define ADCON1_ADDR     0xFC1U
+#define ADCON0_ADDR     0xFC2U
+#define ADRESL_ADDR     0xFC3U
+#define ADRESH_ADDR     0xFC4U
+#define SSPCON2_ADDR    0xFC5U
+#define SSPCON1_ADDR    0xFC6U
+#define SSPSTAT_ADDR    0xFC7U
+#define SSPADD_ADDR     0xFC8U
+#define SSPBUF_ADDR     0xFC9U
+#define T2CON_ADDR      0xFCAU
+#define PR2_ADDR        0xFCBU
+#define TMR2_ADDR       0xFCCU
+#define T1CON_ADDR      0xFCDU
+#define TMR1L_ADDR      0xFCEU
+#define TMR1H_ADDR      0xFCFU
+#define RCON_ADDR       0xFD0U
+#define T0CON_ADDR      0xFD5U
+#define TMR0L_ADDR      0xFD6U
+#define TMR0H_ADDR      0xFD7U
+#define INTCON3_ADDR    0xFF0U
+#define INTCON2_ADDR    0xFF1U
+#define INTCON_ADDR     0xFF2U
+
+/* Bit positions used by the drivers through the _REG_BIT_POSN names */
+#define _TRISA_RA0_POSN     0x0
+#define _TRISA_RA1_POSN     0x1
+#define _TRISA_RA2_POSN     0x2
+#define _TRISA_RA3_POSN     0x3
+#define _TRISA_RA5_POSN     0x5
+#define _TRISB_RB0_POSN     0x0
+#define _TRISB_RB1_POSN     0x1
+#define _TRISB_RB2_POSN     0x2
+#define _TRISB_RB3_POSN     0x3
+#define _TRISB_RB4_POSN     0x4
+#define _TRISE_RE0_POSN     0x0
+#define _TRISE_RE1_POSN     0x1
+#define _TRISE_RE2_POSN     0x2
+
+//==================================================
+// Macro Functions Declarations
+//==================================================
+#define PIC18_SFR_BYTE(addr)            (*(volatile uint8_t *)pic18_sim_access(addr))
+#define PIC18_SFR_BITS(type, addr)      (*(volatile type *)pic18_sim_access(addr))
+
+/* Port latches and direction registers: plain memory, address constant */
+#define PORTA       (pic18_sim_sfr[PORTA_ADDR])
+#define PORTB       (pic18_sim_sfr[PORTB_ADDR])
+#define PORTC       (pic18_sim_sfr[PORTC_ADDR])
+#define PORTD       (pic18_sim_sfr[PORTD_ADDR])
+#define PORTE       (pic18_sim_sfr[PORTE_ADDR])
+#define LATA        (pic18_sim_sfr[LATA_ADDR])
+#define LATB        (pic18_sim_sfr[LATB_ADDR])
+#define LATC        (pic18_sim_sfr[LATC_ADDR])
+#define LATD        (pic18_sim_sfr[LATD_ADDR])
+#define LATE        (pic18_sim_sfr[LATE_ADDR])
+#define TRISA       (pic18_sim_sfr[TRISA_ADDR])
+#define TRISB       (pic18_sim_sfr[TRISB_ADDR])
+#define TRISC       (pic18_sim_sfr[TRISC_ADDR])
+#define TRISD       (pic18_sim_sfr[TRISD_ADDR])
+#define TRISE       (pic18_sim_sfr[TRISE_ADDR])
+
+/* Hooked byte-wide registers */
+#define PIE1        PIC18_SFR_BYTE(PIE1_ADDR)
+#define PIR1        PIC18_SFR_BYTE(PIR1_ADDR)
+#define IPR1        PIC18_SFR_BYTE(IPR1_ADDR)
+#define PIE2        PIC18_SFR_BYTE(PIE2_ADDR)
+#define PIR2        PIC18_SFR_BYTE(PIR2_ADDR)
+#define IPR2        PIC18_SFR_BYTE(IPR2_ADDR)
+#define EECON1      PIC18_SFR_BYTE(EECON1_ADDR)
+#define EECON2      PIC18_SFR_BYTE(EECON2_ADDR)
+#define EEDATA      PIC18_SFR_BYTE(EEDATA_ADDR)
+#define EEADR       PIC18_SFR_BYTE(EEADR_ADDR)
+#define EEADRH      PIC18_SFR_BYTE(EEADRH_ADDR)
+#define RCSTA       PIC18_SFR_BYTE(RCSTA_ADDR)
+#define TXSTA       PIC18_SFR_BYTE(TXSTA_ADDR)
+#define TXREG       PIC18_SFR_BYTE(TXREG_ADDR)
+#define RCREG       PIC18_SFR_BYTE(RCREG_ADDR)
+#define SPBRG       PIC18_SFR_BYTE(SPBRG_ADDR)
+#define SPBRGH      PIC18_SFR_BYTE(SPBRGH_ADDR)
+#define T3CON       PIC18_SFR_BYTE(T3CON_ADDR)
+#define TMR3L       PIC18_SFR_BYTE(TMR3L_ADDR)
+#define TMR3H       PIC18_SFR_BYTE(TMR3H_ADDR)
+#define BAUDCON     PIC18_SFR_BYTE(BAUDCON_ADDR)
+#define CCP2CON     PIC18_SFR_BYTE(CCP2CON_ADDR)
+#define CCPR2L      PIC18_SFR_BYTE(CCPR2L_ADDR)
+#define CCPR2H      PIC18_SFR_BYTE(CCPR2H_ADDR)
+#define CCP1CON     PIC18_SFR_BYTE(CCP1CON_ADDR)
+#define CCPR1L      PIC18_SFR_BYTE(CCPR1L_ADDR)
+#define CCPR1H      PIC18_SFR_BYTE(CCPR1H_ADDR)
+#define ADCON2      PIC18_SFR_BYTE(ADCON2_ADDR)
+#define ADCON1      PIC18_SFR_BYTE(ADCON1_ADDR)
+#define ADCON0      PIC18_SFR_BYTE(ADCON0_ADDR)
+#define ADRESL      PIC18_SFR_BYTE(ADRESL_ADDR)
+#define ADRESH      PIC18_SFR_BYTE(ADRESH_ADDR)
+#define SSPCON2     PIC18_SFR_BYTE(SSPCON2_ADDR)
+#define SSPCON1     PIC18_SFR_BYTE(SSPCON1_ADDR)
+#define SSPSTAT     PIC18_SFR_BYTE(SSPSTAT_ADDR)
+#define SSPADD      PIC18_SFR_BYTE(SSPADD_ADDR)
+#define SSPBUF      PIC18_SFR_BYTE(SSPBUF_ADDR)
+#define T2CON       PIC18_SFR_BYTE(T2CON_ADDR)
+#define PR2         PIC18_SFR_BYTE(PR2_ADDR)
+#define TMR2        PIC18_SFR_BYTE(TMR2_ADDR)
+#define T1CON       PIC18_SFR_BYTE(T1CON_ADDR)
+#define TMR1L       PIC18_SFR_BYTE(TMR1L_ADDR)
+#define TMR1H       PIC18_SFR_BYTE(TMR1H_ADDR)
+#define RCON        PIC18_SFR_BYTE(RCON_ADDR)
+#define T0CON       PIC18_SFR_BYTE(T0CON_ADDR)
+#define TMR0L       PIC18_SFR_BYTE(TMR0L_ADDR)
+#define TMR0H       PIC18_SFR_BYTE(TMR0H_ADDR)
+#define INTCON3     PIC18_SFR_BYTE(INTCON3_ADDR)
+#define INTCON2     PIC18_SFR_BYTE(INTCON2_ADDR)
+#define INTCON      PIC18_SFR_BYTE(INTCON_ADDR)
+
+/* Bit-field views */
+#define PORTAbits   PIC18_SFR_BITS(PORTAbits_t, PORTA_ADDR)
+#define PORTBbits   PIC18_SFR_BITS(PORTBbits_t, PORTB_ADDR)
+#define PORTCbits   PIC18_SFR_BITS(PORTCbits_t, PORTC_ADDR)
+#define PORTDbits   PIC18_SFR_BITS(PORTDbits_t, PORTD_ADDR)
+#define PORTEbits   PIC18_SFR_BITS(PORTEbits_t, PORTE_ADDR)
+#define LATAbits    PIC18_SFR_BITS(LATAbits_t, LATA_ADDR)
+#define LATBbits    PIC18_SFR_BITS(LATBbits_t, LATB_ADDR)
+#define LATCbits    PIC18_SFR_BITS(LATCbits_t, LATC_ADDR)
+#define LATDbits    PIC18_SFR_BITS(LATDbits_t, LATD_ADDR)
+#define LATEbits    PIC18_SFR_BITS(LATEbits_t, LATE_ADDR)
+#define TRISAbits   PIC18_SFR_BITS(TRISAbits_t, TRISA_ADDR)
+#define TRISBbits   PIC18_SFR_BITS(TRISBbits_t, TRISB_ADDR)
+#define TRISCbits   PIC18_SFR_BITS(TRISCbits_t, TRISC_ADDR)
+#define TRISDbits   PIC18_SFR_BITS(TRISDbits_t, TRISD_ADDR)
+#define TRISEbits   PIC18_SFR_BITS(TRISEbits_t, TRISE_ADDR)
+#define PIE1bits    PIC18_SFR_BITS(PIE1bits_t, PIE1_ADDR)
+#define PIR1bits    PIC18_SFR_BITS(PIR1bits_t, PIR1_ADDR)
+#define IPR1bits    PIC18_SFR_BITS(IPR1bits_t, IPR1_ADDR)
+#define PIE2bits    PIC18_SFR_BITS(PIE2bits_t, PIE2_ADDR)
+#define PIR2bits    PIC18_SFR_BITS(PIR2bits_t, PIR2_ADDR)
+#define IPR2bits    PIC18_SFR_BITS(IPR2bits_t, IPR2_ADDR)
+#define EECON1bits  PIC18_SFR_BITS(EECON1bits_t, EECON1_ADDR)
+#define RCSTAbits   PIC18_SFR_BITS(RCSTAbits_t, RCSTA_ADDR)
+#define TXSTAbits   PIC18_SFR_BITS(TXSTAbits_t, TXSTA_ADDR)
+#define T3CONbits   PIC18_SFR_BITS(T3CONbits_t, T3CON_ADDR)
+#define BAUDCONbits PIC18_SFR_BITS(BAUDCONbits_t, BAUDCON_ADDR)
+#define CCP2CONbits PIC18_SFR_BITS(CCP2CONbits_t, CCP2CON_ADDR)
+#define CCP1CONbits PIC18_SFR_BITS(CCP1CONbits_t, CCP1CON_ADDR)
+#define ADCON2bits  PIC18_SFR_BITS(ADCON2bits_t, ADCON2_ADDR)
+#define ADCON1bits  PIC18_SFR_BITS(ADCON1bits_t, ADCON1_ADDR)
+#define ADCON0bits  PIC18_SFR_BITS(ADCON0bits_t, ADCON0_ADDR)
+#define SSPCON2bits PIC18_SFR_BITS(SSPCON2bits_t, SSPCON2_ADDR)
+#define SSPCON1bits PIC18_SFR_BITS(SSPCON1bits_t, SSPCON1_ADDR)
+#define SSPSTATbits PIC18_SFR_BITS(SSPSTATbits_t, SSPSTAT_ADDR)
+#define T2CONbits   PIC18_SFR_BITS(T2CONbits_t, T2CON_ADDR)
+#define T1CONbits   PIC18_SFR_BITS(T1CONbits_t, T1CON_ADDR)
+#define RCONbits    PIC18_SFR_BITS(RCONbits_t, RCON_ADDR)
+#define T0CONbits   PIC18_SFR_BITS(T0CONbits_t, T0CON_ADDR)
+#define INTCON3bits PIC18_SFR_BITS(INTCON3bits_t, INTCON3_ADDR)
+#define INTCON2bits PIC18_SFR_BITS(INTCON2bits_t, INTCON2_ADDR)
+#define INTCONbits  PIC18_SFR_BITS(INTCONbits_t, INTCON_ADDR)
+
+/* Compiler intrinsics */
+#define __interrupt(...)
+#define NOP()               pic18_sim_delay_cycles(1UL)
+#define CLRWDT()            ((void)0)
+#define SLEEP()             ((void)0)
+#define __delay_us(x)       pic18_sim_delay_cycles((uint32_t)((x) * (_XTAL_FREQ / 4000000.0)))
+#define __delay_ms(x)       pic18_sim_delay_cycles((uint32_t)((x) * (_XTAL_FREQ / 4000.0)))
+
+//==================================================
+// Data Types Declarations
+//==================================================
+#define PIC18_PORT_BITS(P, n)                                               \
+    typedef union {                                                         \
+        struct { uint8_t R##P##0:1, R##P##1:1, R##P##2:1, R##P##3:1,        \
+                         R##P##4:1, R##P##5:1, R##P##6:1, R##P##7:1; };     \
+    } n
+
+#define PIC18_LAT_BITS(P, n)                                                \
+    typedef union {                                                         \
+        struct { uint8_t LAT##P##0:1, LAT##P##1:1, LAT##P##2:1,             \
+                         LAT##P##3:1, LAT##P##4:1, LAT##P##5:1,             \
+                         LAT##P##6:1, LAT##P##7:1; };                       \
+    } n
+
+#define PIC18_TRIS_BITS(P, n)                                               \
+    typedef union {                                                         \
+        struct { uint8_t TRIS##P##0:1, TRIS##P##1:1, TRIS##P##2:1,          \
+                         TRIS##P##3:1, TRIS##P##4:1, TRIS##P##5:1,          \
+                         TRIS##P##6:1, TRIS##P##7:1; };                     \
+        struct { uint8_t R##P##0:1, R##P##1:1, R##P##2:1, R##P##3:1,        \
+                         R##P##4:1, R##P##5:1, R##P##6:1, R##P##7:1; };     \
+    } n
+
+PIC18_PORT_BITS(A, PORTAbits_t);
+PIC18_PORT_BITS(B, PORTBbits_t);
+PIC18_PORT_BITS(C, PORTCbits_t);
+PIC18_PORT_BITS(D, PORTDbits_t);
+PIC18_PORT_BITS(E, PORTEbits_t);
+PIC18_LAT_BITS(A, LATAbits_t);
+PIC18_LAT_BITS(B, LATBbits_t);
+PIC18_LAT_BITS(C, LATCbits_t);
+PIC18_LAT_BITS(D, LATDbits_t);
+PIC18_LAT_BITS(E, LATEbits_t);
+PIC18_TRIS_BITS(A, TRISAbits_t);
+PIC18_TRIS_BITS(B, TRISBbits_t);
+PIC18_TRIS_BITS(C, TRISCbits_t);
+PIC18_TRIS_BITS(D, TRISDbits_t);
+PIC18_TRIS_BITS(E, TRISEbits_t);
+
+typedef union {
+    struct { uint8_t TMR1IE:1, TMR2IE:1, CCP1IE:1, SSPIE:1, TXIE:1, RCIE:1, ADIE:1, PSPIE:1; };
+} PIE1bits_t;
+
+typedef union {
+    struct { uint8_t TMR1IF:1, TMR2IF:1, CCP1IF:1, SSPIF:1, TXIF:1, RCIF:1, ADIF:1, PSPIF:1; };
+} PIR1bits_t;
+
+typedef union {
+    struct { uint8_t TMR1IP:1, TMR2IP:1, CCP1IP:1, SSPIP:1, TXIP:1, RCIP:1, ADIP:1, PSPIP:1; };
+} IPR1bits_t;
+
+typedef union {
+    struct { uint8_t CCP2IE:1, TMR3IE:1, HLVDIE:1, BCLIE:1, EEIE:1, :1, CMIE:1, OSCFIE:1; };
+} PIE2bits_t;
+
+typedef union {
+    struct { uint8_t CCP2IF:1, TMR3IF:1, HLVDIF:1, BCLIF:1, EEIF:1, :1, CMIF:1, OSCFIF:1; };
+} PIR2bits_t;
+
+typedef union {
+    struct { uint8_t CCP2IP:1, TMR3IP:1, HLVDIP:1, BCLIP:1, EEIP:1, :1, CMIP:1, OSCFIP:1; };
+} IPR2bits_t;
+
+typedef union {
+    struct { uint8_t RD:1, WR:1, WREN:1, WRERR:1, FREE:1, :1, CFGS:1, EEPGD:1; };
+} EECON1bits_t;
+
+typedef union {
+    struct { uint8_t RX9D:1, OERR:1, FERR:1, ADDEN:1, CREN:1, SREN:1, RX9:1, SPEN:1; };
+} RCSTAbits_t;
+
+typedef union {
+    struct { uint8_t TX9D:1, TRMT:1, BRGH:1, SENDB:1, SYNC:1, TXEN:1, TX9:1, CSRC:1; };
+} TXSTAbits_t;
+
+typedef union {
+    struct { uint8_t TMR3ON:1, TMR3CS:1, T3SYNC:1, T3CCP1:1, T3CKPS:2, T3CCP2:1, RD16:1; };
+    struct { uint8_t :2, nT3SYNC:1, :1, T3CKPS0:1, T3CKPS1:1, :2; };
+} T3CONbits_t;
+
+typedef union {
+    struct { uint8_t ABDEN:1, WUE:1, :1, BRG16:1, SCKP:1, :1, RCIDL:1, ABDOVF:1; };
+} BAUDCONbits_t;
+
+typedef union {
+    struct { uint8_t CCP2M:4, DC2B:2, :2; };
+    struct { uint8_t CCP2M0:1, CCP2M1:1, CCP2M2:1, CCP2M3:1, DC2B0:1, DC2B1:1, :2; };
+} CCP2CONbits_t;
+
+typedef union {
+    struct { uint8_t CCP1M:4, DC1B:2, :2; };
+    struct { uint8_t CCP1M0:1, CCP1M1:1, CCP1M2:1, CCP1M3:1, DC1B0:1, DC1B1:1, :2; };
+} CCP1CONbits_t;
+
+typedef union {
+    struct { uint8_t ADCS:3, ACQT:3, :1, ADFM:1; };
+} ADCON2bits_t;
+
+typedef union {
+    struct { uint8_t PCFG:4, VCFG0:1, VCFG1:1, :2; };
+} ADCON1bits_t;
+
+typedef union {
+    struct { uint8_t ADON:1, GODONE:1, CHS:4, :2; };
+    struct { uint8_t :1, GO:1, :6; };
+    struct { uint8_t :1, nDONE:1, :6; };
+} ADCON0bits_t;
+
+typedef union {
+    struct { uint8_t SEN:1, RSEN:1, PEN:1, RCEN:1, ACKEN:1, ACKDT:1, ACKSTAT:1, GCEN:1; };
+} SSPCON2bits_t;
+
+typedef union {
+    struct { uint8_t SSPM:4, CKP:1, SSPEN:1, SSPOV:1, WCOL:1; };
+} SSPCON1bits_t;
+
+typedef union {
+    struct { uint8_t BF:1, UA:1, R_W:1, S:1, P:1, D_nA:1, CKE:1, SMP:1; };
+    struct { uint8_t :2, R_nW:1, :2, D_A:1, :2; };
+} SSPSTATbits_t;
+
+typedef union {
+    struct { uint8_t T2CKPS:2, TMR2ON:1, TOUTPS:4, :1; };
+} T2CONbits_t;
+
+typedef union {
+    struct { uint8_t TMR1ON:1, TMR1CS:1, T1SYNC:1, T1OSCEN:1, T1CKPS:2, T1RUN:1, RD16:1; };
+    struct { uint8_t :2, nT1SYNC:1, :5; };
+} T1CONbits_t;
+
+typedef union {
+    struct { uint8_t nBOR:1, nPOR:1, nPD:1, nTO:1, nRI:1, :1, SBOREN:1, IPEN:1; };
+} RCONbits_t;
+
+typedef union {
+    struct { uint8_t T0PS:3, PSA:1, T0SE:1, T0CS:1, T08BIT:1, TMR0ON:1; };
+} T0CONbits_t;
+
+typedef union {
+    struct { uint8_t INT1IF:1, INT2IF:1, :1, INT1IE:1, INT2IE:1, :1, INT1IP:1, INT2IP:1; };
+} INTCON3bits_t;
+
+typedef union {
+    struct { uint8_t RBIP:1, :1, TMR0IP:1, :1, INTEDG2:1, INTEDG1:1, INTEDG0:1, nRBPU:1; };
+} INTCON2bits_t;
+
+typedef union {
+    struct { uint8_t RBIF:1, INT0IF:1, TMR0IF:1, RBIE:1, INT0IE:1, TMR0IE:1, PEIE:1, GIE:1; };
+    struct { uint8_t :1, INT0F:1, T0IF:1, :1, INT0E:1, T0IE:1, GIEL:1, GIEH:1; };
+} INTCONbits_t;
+
+//==================================================
+// Functions Declarations
+//==================================================
+extern volatile uint8_t pic18_sim_sfr[PIC18_SIM_SFR_SIZE];
+
+volatile void *pic18_sim_access(uint16_t addr);
+void pic18_sim_delay_cycles(uint32_t cycles);
+
+#endif /* HOST_XC_H */
@@ -15,6 +15,31 @@
 //==================================================
 #if ADC_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
 static void (*ADC_InterruptHandler)(void) = NULL;
+
+static const adc_config_t *ADC_Scan_Config = NULL;
+static const adc_scan_t *ADC_Scan = NULL;
+static volatile uint8 ADC_Scan_Active = 0;
+static volatile uint8 ADC_Scan_Index = 0;
+static volatile uint16 ADC_Scan_Passes = 0;
+/* Two halves per entry, ADC_Scan_Published[i] is the half readers use */
+static volatile uint16 ADC_Scan_Result[2][ADC_SCAN_MAX_CHANNELS];
+static volatile uint8 ADC_Scan_Published[ADC_SCAN_MAX_CHANNELS];
+static volatile uint8 ADC_Scan_Valid = 0;     /* one bit per entry, so at most 8 */
+static const adc_config_t *ADC_Trigger_Config = NULL;
+static volatile uint8 ADC_Trigger_Active = 0;
+/* Free running indexes, the ISR only moves head and the reader only moves tail */
+static volatile uint16 ADC_Trigger_Buffer[ADC_TRIGGER_BUFFER_SIZE];
+static volatile uint8 ADC_Trigger_Head = 0;
+static volatile uint8 ADC_Trigger_Tail = 0;
+static volatile uint16 ADC_Trigger_Overruns = 0;
+static const adc_config_t *ADC_Filter_Config = NULL;
+static adc_filter_t *volatile ADC_Filter = NULL;
+#if ADC_SCAN_MAX_CHANNELS > 8U
+#error "ADC_SCAN_MAX_CHANNELS must not exceed 8"
+#endif
+
+static void ADC_Scan_Service(void);
+static void ADC_Trigger_Service(void);
 #endif
 static inline void ADC_Input_Channel_Pin_Config(adc_channel_t channel);
 static inline void ADC_Select_Result_Format(const adc_config_t *adc);
@@ -215,6 +240,11 @@ Std_ReturnType ADC_Get_Conversion_Blocking(const adc_config_t *adc, adc_channel_
 
     if (NULL == adc || NULL == adc_res) {
         ret = E_NOT_OK;
+#if ADC_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    } else if (ADC_Scan_Active || ADC_Trigger_Active) {
+        //The scan sequencer or the CCP2 trigger owns the ADC
+        ret = E_NOT_OK;
+#endif
     } else {
         //Select the channel
         ret = ADC_Select_Channel(adc, channel);
@@ -247,6 +277,11 @@ Std_ReturnType ADC_Start_Conversion_Interrupt(const adc_config_t *adc, adc_chann
 
     if (NULL == adc) {
         ret = E_NOT_OK;
+#if ADC_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    } else if (ADC_Scan_Active || ADC_Trigger_Active) {
+        //The scan sequencer or the CCP2 trigger owns the ADC
+        ret = E_NOT_OK;
+#endif
     } else {
         //Select the channel
         ret = ADC_Select_Channel(adc, channel);
@@ -256,6 +291,282 @@ Std_ReturnType ADC_Start_Conversion_Interrupt(const adc_config_t *adc, adc_chann
     return ret;
 }
 
+#if ADC_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Starts converting a list of channels in round robin from ADC_ISR.
+ * 
+ * Each ADC interrupt stores the finished result, moves ADCON0bits.CHS to the next
+ * channel and starts it. With acq_time above ADC_0_TAD the hardware inserts the
+ * acquisition time after GO, otherwise ADC_SCAN_ACQ_DELAY_US is waited first.
+ * While a scan runs the configuration's ADC_InterruptHandler is not called and
+ * the blocking conversion is refused.
+ * 
+ * @param adc A pointer to the ADC configuration structure, used for the result format.
+ * @param scan A pointer to the scan configuration, both must stay valid while scanning.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Scan_Start(const adc_config_t *adc, const adc_scan_t *scan) {
+    Std_ReturnType ret = E_OK;
+
+    if ((NULL == adc) || (NULL == scan) || (NULL == scan->channels) ||
+            (0 == scan->channel_count) || (scan->channel_count > ADC_SCAN_MAX_CHANNELS)) {
+        ret = E_NOT_OK;
+    } else if (ADC_Scan_Active || ADC_Trigger_Active || ADC_STATUS()) {
+        //A scan, the CCP2 trigger or a single conversion is still running
+        ret = E_NOT_OK;
+    } else {
+        //Every pin of the list is made an input once, the ISR only switches CHS
+        for (uint8 index = 0; index < scan->channel_count; index++) {
+            ADC_Input_Channel_Pin_Config(scan->channels[index]);
+            ADC_Scan_Published[index] = 0;
+        }
+        ADC_Scan_Config = adc;
+        ADC_Scan = scan;
+        ADC_Scan_Index = 0;
+        ADC_Scan_Passes = 0;
+        ADC_Scan_Valid = 0;
+        ADC_Scan_Active = 1;
+
+        ADC_INTERRUPT_FLAG_CLEAR();
+        ADC_INTERRUPT_ENABLE();
+        ADCON0bits.CHS = scan->channels[0];
+        if (ADC_0_TAD == adc->acq_time) {
+            __delay_us(ADC_SCAN_ACQ_DELAY_US);
+        }
+        ADC_START_CONV();
+    }
+    return ret;
+}
+
+/**
+ * @brief Stops the scan, the results stay readable.
+ * 
+ * The conversion in progress is waited for and thrown away, so it never reaches
+ * the filter or the configuration's ADC_InterruptHandler.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Scan_Stop(void) {
+    Std_ReturnType ret = E_OK;
+
+    uint8 ADC_Interrupt_Status = PIE1bits.ADIE;
+
+    //Masked so the last conversion can't reach ADC_ISR as a plain one
+    ADC_INTERRUPT_DISABLE();
+    if (ADC_Scan_Active) {
+        ADC_Scan_Active = 0;
+        while (ADC_STATUS());
+        ADC_INTERRUPT_FLAG_CLEAR();
+    }
+    PIE1bits.ADIE = ADC_Interrupt_Status;
+    return ret;
+}
+
+/**
+ * @brief Reads the latest result of one entry of the scan list without masking interrupts.
+ * 
+ * Each entry is double buffered: ADC_ISR fills the idle half and then publishes it,
+ * so the half read here is never the one being written.
+ * 
+ * @param index Position of the channel in the scan list.
+ * @param adc_res A pointer to store the digital result of the conversion.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Bad index, or the entry has not been converted yet.
+ */
+Std_ReturnType ADC_Scan_Read(uint8 index, uint16 *adc_res) {
+    Std_ReturnType ret = E_OK;
+    uint8 half;
+
+    if ((NULL == adc_res) || (index >= ADC_SCAN_MAX_CHANNELS) || !(ADC_Scan_Valid & (uint8)(1U << index))) {
+        ret = E_NOT_OK;
+    } else {
+        //If the ISR published a new half while this copied, copy again
+        do {
+            half = ADC_Scan_Published[index];
+            *adc_res = ADC_Scan_Result[half][index];
+        } while (half != ADC_Scan_Published[index]);
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the number of complete passes over the scan list since ADC_Scan_Start.
+ * 
+ * @param passes A pointer to store the pass count, it wraps at 65535.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Scan_Get_Passes(uint16 *passes) {
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == passes) {
+        ret = E_NOT_OK;
+    } else {
+        //16-bit counter written by the ISR, mask it for the two byte copy
+        uint8 ADC_Interrupt_Status = PIE1bits.ADIE;
+        ADC_INTERRUPT_DISABLE();
+        *passes = ADC_Scan_Passes;
+        PIE1bits.ADIE = ADC_Interrupt_Status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Arms one channel for conversions started in hardware by the CCP2 special
+ *        event trigger, and streams every result into a ring buffer from ADC_ISR.
+ * 
+ * CCP2 is set up separately through ccp.c: compare mode with the
+ * CCP_COMPARE_MODE_GEN_EVENT variant, CCPR2 loaded with ADC_TRIGGER_COMPARE_VALUE()
+ * and the selected Timer1/Timer3 running. Each match resets the timer and sets GO,
+ * so the sample period does not depend on software. Use an acq_time above
+ * ADC_0_TAD, nothing waits between the trigger and the conversion.
+ * 
+ * @param adc A pointer to the ADC configuration structure, used for the result format.
+ * @param channel The channel to be sampled.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred, a scan or conversion is in progress, or a
+ *           filter is attached and the result format is left justified.
+ */
+Std_ReturnType ADC_Trigger_Start(const adc_config_t *adc, adc_channel_t channel) {
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == adc) {
+        ret = E_NOT_OK;
+    } else if (ADC_Scan_Active || ADC_Trigger_Active || ADC_STATUS()) {
+        //A scan, the CCP2 trigger or a single conversion is still running
+        ret = E_NOT_OK;
+    } else if (ADC_Filter && (ADC_RESULT_RIGHT != adc->res_format)) {
+        //The attached filter sums right justified 10-bit results only
+        ret = E_NOT_OK;
+    } else {
+        ADC_Input_Channel_Pin_Config(channel);
+        ADCON0bits.CHS = channel;
+
+        ADC_Trigger_Config = adc;
+        ADC_Trigger_Head = 0;
+        ADC_Trigger_Tail = 0;
+        ADC_Trigger_Overruns = 0;
+        ADC_Trigger_Active = 1;
+
+        //GO is left to the special event, the first result comes with the next match
+        ADC_INTERRUPT_FLAG_CLEAR();
+        ADC_INTERRUPT_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief Stops storing triggered results, the buffered ones stay readable.
+ *        CCP2 keeps triggering until it is stopped through ccp.c.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Trigger_Stop(void) {
+    Std_ReturnType ret = E_OK;
+
+    ADC_Trigger_Active = 0;
+    return ret;
+}
+
+/**
+ * @brief Copies up to maxlen triggered results out of the ring buffer, oldest first.
+ * 
+ * @param buf A pointer to store the results.
+ * @param maxlen Size of buf in results.
+ * @param read_len A pointer to store the number of results copied, may be 0.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Trigger_Read(uint16 *buf, uint8 maxlen, uint8 *read_len) {
+    Std_ReturnType ret = E_OK;
+
+    if ((NULL == buf) || (NULL == read_len)) {
+        ret = E_NOT_OK;
+    } else {
+        //Head is one byte, a single read gives a consistent snapshot
+        uint8 head = ADC_Trigger_Head;
+        uint8 tail = ADC_Trigger_Tail;
+        uint8 count = 0;
+
+        while ((tail != head) && (count < maxlen)) {
+            buf[count++] = ADC_Trigger_Buffer[tail & ADC_TRIGGER_BUFFER_MASK];
+            tail++;
+        }
+        //Published after the copy so the ISR never overwrites what is being read
+        ADC_Trigger_Tail = tail;
+        *read_len = count;
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the number of triggered results dropped because the ring was full.
+ * 
+ * @param overruns A pointer to store the count, it saturates at 65535.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Trigger_Get_Overruns(uint16 *overruns) {
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == overruns) {
+        ret = E_NOT_OK;
+    } else {
+        //16-bit counter written by the ISR, mask it for the two byte copy
+        uint8 ADC_Interrupt_Status = PIE1bits.ADIE;
+        ADC_INTERRUPT_DISABLE();
+        *overruns = ADC_Trigger_Overruns;
+        PIE1bits.ADIE = ADC_Interrupt_Status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Attaches a result filter that ADC_ISR feeds with every single conversion
+ *        and every CCP2 triggered conversion, scan results are not filtered.
+ * 
+ * In triggered mode the ring then receives the filter outputs instead of the raw
+ * results, so sampling 4^n times faster gives n extra bits at the same output rate.
+ * With a single conversion the ADC_InterruptHandler reads it with ADC_Filter_Read().
+ * 
+ * @param adc A pointer to the ADC configuration structure, its res_format is used.
+ * @param filter A pointer to an initialized filter, NULL detaches the current one.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null configuration, or a left justified result format.
+ */
+Std_ReturnType ADC_Filter_Attach(const adc_config_t *adc, adc_filter_t *filter) {
+    Std_ReturnType ret = E_OK;
+
+    if ((NULL == adc) && (NULL != filter)) {
+        ret = E_NOT_OK;
+    } else if ((NULL != filter) && ((ADC_RESULT_RIGHT != adc->res_format) ||
+            (ADC_Trigger_Active && (ADC_RESULT_RIGHT != ADC_Trigger_Config->res_format)))) {
+        //A left justified result is 64 times larger and overflows the decimation sum
+        ret = E_NOT_OK;
+    } else {
+        //The ISR must never see a filter without its configuration
+        uint8 ADC_Interrupt_Status = PIE1bits.ADIE;
+        ADC_INTERRUPT_DISABLE();
+        ADC_Filter_Config = adc;
+        ADC_Filter = filter;
+        PIE1bits.ADIE = ADC_Interrupt_Status;
+    }
+    return ret;
+}
+#endif
+
 //==================================================
 // static Definitions
 //==================================================
@@ -331,6 +642,73 @@ static inline void ADC_Select_Volt_Ref(const adc_config_t *adc) {
     }
 }
 
+#if ADC_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Scan step run from ADC_ISR: stores the finished result in the idle half
+ *        of its entry, publishes it, then starts the next channel of the list.
+ */
+static void ADC_Scan_Service(void) {
+    uint8 index = ADC_Scan_Index;
+    uint8 half = (uint8) (ADC_Scan_Published[index] ^ 1U);
+    uint8 pass_done = 0;
+    uint16 result = 0;
+
+    (void) ADC_Get_Result(ADC_Scan_Config, &result);
+    ADC_Scan_Result[half][index] = result;
+    ADC_Scan_Published[index] = half;
+    ADC_Scan_Valid |= (uint8) (1U << index);
+
+    index++;
+    if (index >= ADC_Scan->channel_count) {
+        index = 0;
+        ADC_Scan_Passes++;
+        pass_done = 1;
+        if (!ADC_Scan->continuous) {
+            ADC_Scan_Active = 0;
+        }
+    }
+    ADC_Scan_Index = index;
+
+    if (ADC_Scan_Active) {
+        ADCON0bits.CHS = ADC_Scan->channels[index];
+        if (ADC_0_TAD == ADC_Scan_Config->acq_time) {
+            __delay_us(ADC_SCAN_ACQ_DELAY_US);
+        }
+        ADC_START_CONV();
+    }
+    if (pass_done && ADC_Scan->ADC_ScanCompleteHandler) {
+        ADC_Scan->ADC_ScanCompleteHandler();
+    }
+}
+
+/**
+ * @brief Triggered step run from ADC_ISR: queues the result of the conversion
+ *        CCP2 started, or counts it as an overrun when the ring is full.
+ */
+static void ADC_Trigger_Service(void) {
+    Std_ReturnType ret = E_OK;
+    uint8 head = ADC_Trigger_Head;
+    uint16 result = 0;
+
+    (void) ADC_Get_Result(ADC_Trigger_Config, &result);
+    if (ADC_Filter) {
+        //Only the decimated, filtered values are queued
+        ret = ADC_Filter_Push(ADC_Filter, result);
+        result = ADC_Filter->output;
+    }
+    if (E_OK != ret) {
+        /* Nothing, the result went into the value in progress */
+    } else if ((uint8) (head - ADC_Trigger_Tail) >= ADC_TRIGGER_BUFFER_SIZE) {
+        if (ADC_Trigger_Overruns < 0xFFFFU) {
+            ADC_Trigger_Overruns++;
+        }
+    } else {
+        ADC_Trigger_Buffer[head & ADC_TRIGGER_BUFFER_MASK] = result;
+        ADC_Trigger_Head = (uint8) (head + 1U);
+    }
+}
+#endif
+
 //==================================================
 // ISR Functions
 //==================================================
@@ -345,10 +723,21 @@ void ADC_ISR(void) {
     //The ADC interrupt occurred, the flag must be cleared.
     ADC_INTERRUPT_FLAG_CLEAR();
     /* Code */
-
-    //CallBack func gets called every time this ISR executes.
-    if (ADC_InterruptHandler) {
-        ADC_InterruptHandler();
+    if (ADC_Trigger_Active) {
+        ADC_Trigger_Service();
+    } else if (ADC_Scan_Active) {
+        ADC_Scan_Service();
+    }
+    //CallBack func gets called every time this ISR executes outside a scan or trigger.
+    else {
+        if (ADC_Filter) {
+            uint16 result = 0;
+            (void) ADC_Get_Result(ADC_Filter_Config, &result);
+            (void) ADC_Filter_Push(ADC_Filter, result);
+        }
+        if (ADC_InterruptHandler) {
+            ADC_InterruptHandler();
+        }
     }
 #endif    
 }
@@ -14,6 +14,7 @@
 #include "../GPIO/gpio.h"
 #include "../Interrupt/internal_interrupt.h"
 #include "adc_cfg.h"
+#include "adc_filter.h"
 
 //==================================================
 // Macro Declarations
@@ -42,6 +43,11 @@
 #define ADC_VOLT_REF_ENABLE   0x01U
 #define ADC_VOLT_REF_DISABLE  0x00U
 
+#if (ADC_TRIGGER_BUFFER_SIZE < 2U) || (ADC_TRIGGER_BUFFER_SIZE > 128U) || (ADC_TRIGGER_BUFFER_SIZE & (ADC_TRIGGER_BUFFER_SIZE - 1U))
+#error "ADC_TRIGGER_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+#define ADC_TRIGGER_BUFFER_MASK   (ADC_TRIGGER_BUFFER_SIZE - 1U)
+
 //==================================================
 // Macro Functions Declarations 
 //==================================================
@@ -81,6 +87,15 @@
 #define ADC_RESULT_RIGHT_FORMAT()   (ADCON2bits.ADFM = 1) 
 #define ADC_RESULT_LEFT_FORMAT()    (ADCON2bits.ADFM = 0)
 
+/**
+ * @brief CCPR2 compare value for CCP2 special event sampling at RATE_HZ, with
+ *        the selected Timer1/Timer3 clocked from FOSC/4 through TIMER_PRESCALER.
+ *        The special event resets the timer on every match, so this is the
+ *        number of timer ticks between two conversions.
+ */
+#define ADC_TRIGGER_COMPARE_VALUE(RATE_HZ, TIMER_PRESCALER) \
+    ((uint16)((_XTAL_FREQ / 4UL) / (uint32)(TIMER_PRESCALER) / (uint32)(RATE_HZ)))
+
 //==================================================
 // Data Types Declarations
 //==================================================
@@ -164,6 +179,18 @@ typedef struct {
     uint8                  : 6;
 } adc_config_t;
 
+/**
+ * @brief ADC Scan Sequence Configuration
+ * 
+ */
+typedef struct {
+    const adc_channel_t *channels;          /* Converted in this order, pins set as inputs on start */
+    void (* ADC_ScanCompleteHandler)(void); /* Called from ADC_ISR after every pass, may be NULL */
+    uint8 channel_count;                    /* 1 to ADC_SCAN_MAX_CHANNELS */
+    uint8 continuous : 1;                   /* 1: restart after each pass, 0: one pass then stop */
+    uint8            : 7;
+} adc_scan_t;
+
 //==================================================
 // Functions Declarations
 //==================================================
@@ -267,5 +294,127 @@ Std_ReturnType ADC_Get_Conversion_Blocking(const adc_config_t *adc, adc_channel_
  */
 Std_ReturnType ADC_Start_Conversion_Interrupt(const adc_config_t *adc, adc_channel_t channel);
 
+#if ADC_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Starts converting a list of channels in round robin from ADC_ISR.
+ * 
+ * Each ADC interrupt stores the finished result, moves ADCON0bits.CHS to the next
+ * channel and starts it. With acq_time above ADC_0_TAD the hardware inserts the
+ * acquisition time after GO, otherwise ADC_SCAN_ACQ_DELAY_US is waited first.
+ * While a scan runs the configuration's ADC_InterruptHandler is not called and
+ * the blocking conversion is refused.
+ * 
+ * @param adc A pointer to the ADC configuration structure, used for the result format.
+ * @param scan A pointer to the scan configuration, both must stay valid while scanning.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Scan_Start(const adc_config_t *adc, const adc_scan_t *scan);
+
+/**
+ * @brief Stops the scan, the results stay readable.
+ * 
+ * The conversion in progress is waited for and thrown away, so it never reaches
+ * the filter or the configuration's ADC_InterruptHandler.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Scan_Stop(void);
+
+/**
+ * @brief Reads the latest result of one entry of the scan list without masking interrupts.
+ * 
+ * Each entry is double buffered: ADC_ISR fills the idle half and then publishes it,
+ * so the half read here is never the one being written.
+ * 
+ * @param index Position of the channel in the scan list.
+ * @param adc_res A pointer to store the digital result of the conversion.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Bad index, or the entry has not been converted yet.
+ */
+Std_ReturnType ADC_Scan_Read(uint8 index, uint16 *adc_res);
+
+/**
+ * @brief Gets the number of complete passes over the scan list since ADC_Scan_Start.
+ * 
+ * @param passes A pointer to store the pass count, it wraps at 65535.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Scan_Get_Passes(uint16 *passes);
+
+/**
+ * @brief Arms one channel for conversions started in hardware by the CCP2 special
+ *        event trigger, and streams every result into a ring buffer from ADC_ISR.
+ * 
+ * CCP2 is set up separately through ccp.c: compare mode with the
+ * CCP_COMPARE_MODE_GEN_EVENT variant, CCPR2 loaded with ADC_TRIGGER_COMPARE_VALUE()
+ * and the selected Timer1/Timer3 running. Each match resets the timer and sets GO,
+ * so the sample period does not depend on software. Use an acq_time above
+ * ADC_0_TAD, nothing waits between the trigger and the conversion.
+ * 
+ * @param adc A pointer to the ADC configuration structure, used for the result format.
+ * @param channel The channel to be sampled.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred, a scan or conversion is in progress, or a
+ *           filter is attached and the result format is left justified.
+ */
+Std_ReturnType ADC_Trigger_Start(const adc_config_t *adc, adc_channel_t channel);
+
+/**
+ * @brief Stops storing triggered results, the buffered ones stay readable.
+ *        CCP2 keeps triggering until it is stopped through ccp.c.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Trigger_Stop(void);
+
+/**
+ * @brief Copies up to maxlen triggered results out of the ring buffer, oldest first.
+ * 
+ * @param buf A pointer to store the results.
+ * @param maxlen Size of buf in results.
+ * @param read_len A pointer to store the number of results copied, may be 0.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Trigger_Read(uint16 *buf, uint8 maxlen, uint8 *read_len);
+
+/**
+ * @brief Gets the number of triggered results dropped because the ring was full.
+ * 
+ * @param overruns A pointer to store the count, it saturates at 65535.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType ADC_Trigger_Get_Overruns(uint16 *overruns);
+
+/**
+ * @brief Attaches a result filter that ADC_ISR feeds with every single conversion
+ *        and every CCP2 triggered conversion, scan results are not filtered.
+ * 
+ * In triggered mode the ring then receives the filter outputs instead of the raw
+ * results, so sampling 4^n times faster gives n extra bits at the same output rate.
+ * With a single conversion the ADC_InterruptHandler reads it with ADC_Filter_Read().
+ * 
+ * @param adc A pointer to the ADC configuration structure, its res_format is used.
+ * @param filter A pointer to an initialized filter, NULL detaches the current one.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null configuration, or a left justified result format.
+ */
+Std_ReturnType ADC_Filter_Attach(const adc_config_t *adc, adc_filter_t *filter);
+#endif
+
 #endif	/* ADC_H */
 
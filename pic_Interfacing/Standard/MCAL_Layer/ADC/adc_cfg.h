@@ -15,6 +15,23 @@
 //==================================================
 // Macro Declarations
 //==================================================
+/* Longest channel list the scan sequencer accepts */
+#define ADC_SCAN_MAX_CHANNELS       8U
+
+/* Software acquisition delay used between scan channels when acq_time is ADC_0_TAD */
+#define ADC_SCAN_ACQ_DELAY_US       3U
+
+/* Results held for the application in CCP2 triggered sampling, power of two up to 128 */
+#define ADC_TRIGGER_BUFFER_SIZE     32U
+
+/* Highest oversampling of the result filter, 4^3 = 64 samples still fit its 16-bit sum */
+#define ADC_FILTER_MAX_OVERSAMPLE_BITS  3U
+
+/* Longest moving average window of the result filter, 2^4 = 16 values */
+#define ADC_FILTER_MA_MAX_SHIFT         4U
+
+/* Heaviest IIR smoothing of the result filter, a new value weighs 1/2^8 */
+#define ADC_FILTER_IIR_MAX_SHIFT        8U
 
 //==================================================
 // Macro Functions Declarations 
@@ -0,0 +1,151 @@
+/* 
+ * File:   adc_filter.c
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+//==================================================
+// Includes
+//==================================================
+#include "adc_filter.h"
+
+//==================================================
+// Functions Definitions
+//==================================================
+
+/**
+ * @brief Resets a filter and applies its configuration.
+ * 
+ * @param filter A pointer to the filter state.
+ * @param config A pointer to the filter configuration, copied.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or a setting out of range.
+ */
+Std_ReturnType ADC_Filter_Init(adc_filter_t *filter, const adc_filter_config_t *config) {
+    Std_ReturnType ret = E_OK;
+
+    if ((NULL == filter) || (NULL == config) || (config->oversample_bits > ADC_FILTER_MAX_OVERSAMPLE_BITS)) {
+        ret = E_NOT_OK;
+    } else if ((ADC_FILTER_IIR == config->type) && (config->shift > ADC_FILTER_IIR_MAX_SHIFT)) {
+        ret = E_NOT_OK;
+    } else if ((ADC_FILTER_MOVING_AVERAGE == config->type) && (config->shift > ADC_FILTER_MA_MAX_SHIFT)) {
+        ret = E_NOT_OK;
+    } else {
+        filter->config = *config;
+        filter->decim_length = (uint8) (1U << (2U * config->oversample_bits));
+        filter->decim_left = filter->decim_length;
+        filter->decim_sum = 0;
+        filter->primed = 0;
+        filter->ma_index = 0;
+        filter->ma_mask = (uint8) ((1U << config->shift) - 1U);
+        filter->ma_sum = 0;
+        filter->iir_state = 0;
+        filter->output = 0;
+        filter->outputs = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief Feeds one right justified 10-bit sample, meant to be called from ADC_ISR.
+ * 
+ * Every 4^n samples are summed and shifted right by n, which gives 10 + n bits when
+ * the input carries about 1 LSB of noise. That value goes through the configured
+ * filter and becomes the output. Integer only, no division and no float32.
+ * 
+ * @param filter A pointer to the filter state.
+ * @param sample The conversion result.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A new output is ready.
+ *         - E_NOT_OK: The sample was accumulated, or filter is NULL.
+ */
+Std_ReturnType ADC_Filter_Push(adc_filter_t *filter, uint16 sample) {
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 value;
+    uint8 shift;
+    uint8 bits;
+
+    if (NULL == filter) {
+        /* Nothing */
+    } else {
+        //Decimation: 4^n samples summed, the 16-bit sum can't overflow for n <= 3
+        filter->decim_sum += sample;
+        filter->decim_left--;
+        ret = (0 == filter->decim_left) ? E_OK : E_NOT_OK;
+    }
+    if (E_OK == ret) {
+        //Keeping n of the 2n bits the sum grew by gives n extra bits of resolution,
+        //rounded to nearest so the output carries no -0.5 LSB bias
+        bits = filter->config.oversample_bits;
+        value = (uint16) ((filter->decim_sum + ((1U << bits) >> 1)) >> bits);
+        filter->decim_sum = 0;
+        filter->decim_left = filter->decim_length;
+
+        shift = filter->config.shift;
+        if (ADC_FILTER_IIR == filter->config.type) {
+            if (filter->primed) {
+                //state holds y << shift, so the update keeps the bits a plain y would drop
+                filter->iir_state += (uint32) value - (filter->iir_state >> shift);
+            } else {
+                //Seeded with the first value instead of ramping up from 0
+                filter->iir_state = (uint32) value << shift;
+            }
+            //Truncated on purpose: the update truncates the same way, so the two cancel out
+            value = (uint16) (filter->iir_state >> shift);
+        } else if (ADC_FILTER_MOVING_AVERAGE == filter->config.type) {
+            uint8 index = filter->ma_index;
+
+            if (filter->primed) {
+                //Running sum: the oldest value leaves as the new one enters
+                filter->ma_sum -= filter->ma_window[index];
+                filter->ma_sum += value;
+                filter->ma_window[index] = value;
+                filter->ma_index = (uint8) ((index + 1U) & filter->ma_mask);
+            } else {
+                //Seeded with the first value instead of ramping up from 0
+                for (index = 0; index <= filter->ma_mask; index++) {
+                    filter->ma_window[index] = value;
+                }
+                filter->ma_sum = (uint32) value << shift;
+            }
+            value = (uint16) ((filter->ma_sum + ((1UL << shift) >> 1)) >> shift);
+        } else {
+            /* Nothing */
+        }
+        filter->primed = 1;
+
+        //Readers check outputs around their copy of the two byte output
+        filter->output = value;
+        filter->outputs++;
+    } else {
+        /* Nothing */
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the latest output without masking interrupts.
+ * 
+ * @param filter A pointer to the filter state.
+ * @param value A pointer to store the output, 10 + oversample_bits bits wide.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer, or no output has been produced yet.
+ */
+Std_ReturnType ADC_Filter_Read(const adc_filter_t *filter, uint16 *value) {
+    Std_ReturnType ret = E_OK;
+    uint8 outputs;
+
+    if ((NULL == filter) || (NULL == value) || (0 == filter->primed)) {
+        ret = E_NOT_OK;
+    } else {
+        //If the ISR published a new output while this copied, copy again
+        do {
+            outputs = filter->outputs;
+            *value = filter->output;
+        } while (outputs != filter->outputs);
+    }
+    return ret;
+}
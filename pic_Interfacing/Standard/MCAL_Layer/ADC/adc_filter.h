@@ -0,0 +1,106 @@
+/* 
+ * File:   adc_filter.h
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef ADC_FILTER_H
+#define	ADC_FILTER_H
+
+//==================================================
+// Includes
+//==================================================
+#include "../std_types.h"
+#include "adc_cfg.h"
+
+//==================================================
+// Macro Declarations
+//==================================================
+#if ADC_FILTER_MAX_OVERSAMPLE_BITS > 3U
+#error "ADC_FILTER_MAX_OVERSAMPLE_BITS above 3 overflows the 16-bit decimation sum"
+#endif
+
+#define ADC_FILTER_MA_MAX_WINDOW    (1U << ADC_FILTER_MA_MAX_SHIFT)
+
+//==================================================
+// Data Types Declarations
+//==================================================
+/**
+ * @brief Filter applied to every decimated value
+ */
+typedef enum {
+    ADC_FILTER_NONE = 0,
+    ADC_FILTER_IIR,             /* y += (x - y) / 2^shift */
+    ADC_FILTER_MOVING_AVERAGE   /* mean of the last 2^shift values */
+} adc_filter_type_t;
+
+/**
+ * @brief ADC Result Filter Configuration
+ */
+typedef struct {
+    adc_filter_type_t type;
+    uint8 oversample_bits;  /* n: 4^n samples per value, n extra bits, 0 to ADC_FILTER_MAX_OVERSAMPLE_BITS */
+    uint8 shift;            /* IIR weight or moving average window, see adc_filter_type_t */
+} adc_filter_config_t;
+
+/**
+ * @brief ADC Result Filter State, one per filtered signal
+ */
+typedef struct {
+    adc_filter_config_t config;
+    uint16 decim_sum;           /* Samples summed for the value in progress */
+    uint8 decim_left;           /* Samples still missing for that value */
+    uint8 decim_length;         /* 4^oversample_bits */
+    uint8 primed;               /* 0 until the first value seeds the filter */
+    uint8 ma_index;
+    uint8 ma_mask;              /* window - 1 */
+    uint16 ma_window[ADC_FILTER_MA_MAX_WINDOW];
+    uint32 ma_sum;
+    uint32 iir_state;           /* y scaled by 2^shift, keeps the fraction bits */
+    volatile uint16 output;
+    volatile uint8 outputs;     /* Bumped after each new output, wraps */
+} adc_filter_t;
+
+//==================================================
+// Functions Declarations
+//==================================================
+/**
+ * @brief Resets a filter and applies its configuration.
+ * 
+ * @param filter A pointer to the filter state.
+ * @param config A pointer to the filter configuration, copied.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or a setting out of range.
+ */
+Std_ReturnType ADC_Filter_Init(adc_filter_t *filter, const adc_filter_config_t *config);
+
+/**
+ * @brief Feeds one right justified 10-bit sample, meant to be called from ADC_ISR.
+ * 
+ * Every 4^n samples are summed and shifted right by n, which gives 10 + n bits when
+ * the input carries about 1 LSB of noise. That value goes through the configured
+ * filter and becomes the output. Integer only, no division and no float32.
+ * 
+ * @param filter A pointer to the filter state.
+ * @param sample The conversion result.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A new output is ready.
+ *         - E_NOT_OK: The sample was accumulated, or filter is NULL.
+ */
+Std_ReturnType ADC_Filter_Push(adc_filter_t *filter, uint16 sample);
+
+/**
+ * @brief Reads the latest output without masking interrupts.
+ * 
+ * @param filter A pointer to the filter state.
+ * @param value A pointer to store the output, 10 + oversample_bits bits wide.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer, or no output has been produced yet.
+ */
+Std_ReturnType ADC_Filter_Read(const adc_filter_t *filter, uint16 *value);
+
+#endif	/* ADC_FILTER_H */
+
@@ -22,6 +22,9 @@ static void (*CCP2_InterruptHandler)(void) = NULL;
 #endif
 
 static void inline CCP_Interrupt_Config(const ccp_t *_ccp);
+#if CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED || CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED
+static inline Std_ReturnType CCP_PWM_Set_Period(const ccp_t *_ccp);
+#endif
 static void inline CCP_Mode_Timer_Select(const ccp_t *_ccp);
 static Std_ReturnType inline CCP_Capture_Config(const ccp_t *_ccp);
 static Std_ReturnType inline CCP_Compare_Config(const ccp_t *_ccp);
@@ -53,11 +56,12 @@ Std_ReturnType CCP_Init(const ccp_t *_ccp) {
         }
 #if CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED || CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED        
         else if (CCP_PWM_MD == _ccp->mode) {
-            //PWM Freq Initialization
-            PR2 = (uint8) ((_XTAL_FREQ / (_ccp->PWM_Freq * 4.0 * _ccp->timer2_postscaler
-                    * _ccp->timer2_prescaler)) - 1);
+            //PWM Freq Initialization, integer math so no float32 library is linked
+            ret = CCP_PWM_Set_Period(_ccp);
 
-            if (CCP1_INST == _ccp->CCPx) {
+            if (E_OK != ret) {
+                /* Nothing, PR2 can't give this frequency */
+            } else if (CCP1_INST == _ccp->CCPx) {
                 //Enable the PWM
                 CCP1_SET_MODE(CCP_PWM_MODE);
             } else if (CCP2_INST == _ccp->CCPx) {
@@ -217,7 +221,7 @@ Std_ReturnType CCP_Is_Compare_Completed(const ccp_t *_ccp, uint8 *status) {
         } else if (CCP2_INST == _ccp->CCPx) {
             if (CCP_COMPARE_READY == PIR2bits.CCP2IF) {
                 *status = CCP_COMPARE_READY;
-                PIR1bits.CCP1IF = 0;
+                PIR2bits.CCP2IF = 0;
             } else if (CCP_COMPARE_NOT_READY == PIR2bits.CCP2IF) {
                 *status = CCP_COMPARE_NOT_READY;
             } else {
@@ -276,7 +280,8 @@ Std_ReturnType CCP_PWM_Set_Duty(const ccp_t *_ccp, uint8 duty) {
     if (NULL == _ccp) {
         ret = E_NOT_OK;
     } else {
-        duty_temp = (uint16) ((PR2 + 1) * (duty / 100.0) * 4.0);
+        //10-bit duty in Q cycles, 4 per PR2 count, rounded to nearest
+        duty_temp = (uint16) ((((uint32) (PR2 + 1) * 4UL * duty) + 50UL) / 100UL);
 
         if (CCP1_INST == _ccp->CCPx) {
             CCP1CONbits.DC1B = (uint8) (duty_temp & 0x0003);
@@ -357,6 +362,42 @@ void CCP2_ISR(void) {
 //==================================================
 // Statics Definitions
 //==================================================
+#if CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED || CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED
+/**
+ * @brief Loads PR2 for the configured PWM frequency, rounded to the nearest value.
+ *        PWM period = (PR2 + 1) * 4 * TOSC * Timer2 prescaler.
+ * 
+ * @param _ccp A pointer to the CCP configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The frequency is 0 or out of the 8-bit PR2 range.
+ */
+static inline Std_ReturnType CCP_PWM_Set_Period(const ccp_t *_ccp) {
+    Std_ReturnType ret = E_OK;
+    uint32 period_clocks = ZERO_INIT;
+    uint32 counts = ZERO_INIT;
+
+    if ((0 == _ccp->PWM_Freq) || (_ccp->PWM_Freq > (_XTAL_FREQ / 4UL))) {
+        ret = E_NOT_OK;
+    } else {
+        //FOSC clocks per Timer2 count: 4, then 1, 4 or 16 through the prescaler
+        period_clocks = 4UL * _ccp->PWM_Freq;
+        if (CCP_TIMER2_PRESCALER_DIV_4 == _ccp->timer2_prescaler) {
+            period_clocks <<= 2;
+        } else if (CCP_TIMER2_PRESCALER_DIV_16 == _ccp->timer2_prescaler) {
+            period_clocks <<= 4;
+        }
+        counts = (_XTAL_FREQ + (period_clocks >> 1)) / period_clocks;
+        if ((0 == counts) || (counts > 256UL)) {
+            ret = E_NOT_OK;
+        } else {
+            PR2 = (uint8) (counts - 1UL);
+        }
+    }
+    return ret;
+}
+#endif
+
 static void inline CCP_Interrupt_Config(const ccp_t *_ccp) {
     //Configure CCP1 Interrupt
     if (CCP1_INST == _ccp->CCPx) {
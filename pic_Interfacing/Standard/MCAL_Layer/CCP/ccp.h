@@ -28,7 +28,7 @@
 #define CCP_COMPARE_MODE_SET_PIN_HIGH       0x08
 #define CCP_COMPARE_MODE_SET_PIN_LOW        0x09
 #define CCP_COMPARE_MODE_GEN_SW_INTERRUPT   0x0A
-#define CCP_COMPARE_MODE_GEN_EVENT          0x0B
+#define CCP_COMPARE_MODE_GEN_EVENT          0x0B    /* Resets the timer, on CCP2 also starts an A/D conversion */
 #define CCP_PWM_MODE                        0x0C
 
 
@@ -72,6 +72,14 @@
 //CCP2 Module Selection
 #define CCP2_SET_MODE(_CONGIF)      (CCP2CONbits.CCP2M = _CONGIF)
 
+/**
+ * @brief PR2 value for a PWM frequency with Timer2 dividing FOSC/4 by PRESCALER_DIV
+ *        (1, 4 or 16), rounded to nearest. Plain integer arithmetic, so it also works
+ *        in #if to check a constant frequency against the 8-bit PR2 at build time.
+ */
+#define CCP_PWM_PR2_VALUE(FREQ, PRESCALER_DIV) \
+    (((_XTAL_FREQ + ((4UL * (PRESCALER_DIV) * (FREQ)) / 2UL)) / (4UL * (PRESCALER_DIV) * (FREQ))) - 1UL)
+
 //==================================================
 // Data Types Declarations
 //==================================================
@@ -131,8 +139,8 @@ typedef struct {
 #endif
 #if CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED || CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED
     uint32 PWM_Freq; //CCP PWM Mode Frequency
-    uint8 timer2_postscaler : 4;
-    uint8 timer2_prescaler : 2;
+    uint8 timer2_postscaler : 4; //Not part of the PWM period, it only paces TMR2IF
+    uint8 timer2_prescaler : 2; //@ref Timer2 Prescaler values
 #endif
 } ccp_t;
 
@@ -10,6 +10,21 @@
 //==================================================
 #include "eeprom.h"
 
+//==================================================
+// statics
+//==================================================
+#if EEPROM_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+static void (*EEPROM_WriteCompleteHandler)(void) = NULL;
+static volatile uint8 EEPROM_Write_Busy = 0;
+static uint16 EEPROM_Async_Address;
+static const uint8 *EEPROM_Async_Data;
+static uint16 EEPROM_Async_Remaining;
+static uint8 EEPROM_Async_Byte;
+static uint8 EEPROM_Async_Start_Next(void);
+#endif
+static void EEPROM_Start_Write(uint16 bAdd, uint8 bData);
+static void EEPROM_Read(uint16 bAdd, uint8 *bData);
+
 //==================================================
 // Functions Definitions
 //==================================================
@@ -26,6 +41,215 @@
 Std_ReturnType EEPROM_WriteByte(uint16 bAdd, uint8 bData) {
     Std_ReturnType ret = E_OK;
 
+#if EEPROM_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    //An interrupt driven write owns the EEPROM until its EEIF
+    if (EEPROM_Write_Busy) {
+        ret = E_NOT_OK;
+    } else {
+        /* Nothing */
+    }
+#endif
+    if (E_OK == ret) {
+        EEPROM_Start_Write(bAdd, bData);
+
+        //Wait for a while unitl write is completed, interrupts may run meanwhile
+        while (INITIATE_EEPROM_DATA_WRITE_ERASE == EECON1bits.WR);
+    } else {
+        /* Nothing */
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads one byte of data from a specific EEPROM Address.
+ * 
+ * @param bAdd The EEPROM address to read from..
+ * @param bData A pointer to store the read data.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A NULL pointer, or a write is in progress.
+ */
+Std_ReturnType EEPROM_ReadByte(uint16 bAdd, uint8 *bData) {
+    Std_ReturnType ret = E_OK;
+    //Reads the Interrupt Status "enabled or disabled"
+    uint8 Global_Interrupt_Status = INTCONbits.GIE;
+    uint8 Write_Busy = 0;
+
+    //The EEIF handler starts the next byte of an async write, it must not run
+    //between the busy check and the read
+    INTCONbits.GIE = INTERRUPT_DISABLE;
+    Write_Busy = (INITIATE_EEPROM_DATA_WRITE_ERASE == EECON1bits.WR);
+#if EEPROM_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    Write_Busy |= EEPROM_Write_Busy;
+#endif
+    if ((NULL == bData) || Write_Busy) {
+        //EEADR must not change while a write cycle is in progress
+        ret = E_NOT_OK;
+    } else {
+        EEPROM_Read(bAdd, bData);
+    }
+    //Restores the Interrupt Status "enabled or disabled"
+    INTCONbits.GIE = Global_Interrupt_Status;
+    return ret;
+}
+
+#if EEPROM_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Starts writing one byte of data to a specific EEPROM Address and returns
+ *        without waiting for the ~4 ms write cycle.
+ * 
+ * Same as EEPROM_WriteBuffer_Async() with a one byte buffer, the byte is copied.
+ * 
+ * @param bAdd The EEPROM address to write at.
+ * @param bData Data to be written.
+ * @param WriteCompleteHandler Called once the byte is written, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A write is still in progress.
+ */
+Std_ReturnType EEPROM_WriteByte_Async(uint16 bAdd, uint8 bData, void (*WriteCompleteHandler)(void)) {
+    Std_ReturnType ret = E_OK;
+
+    if (EEPROM_Write_Busy) {
+        ret = E_NOT_OK;
+    } else {
+        EEPROM_Async_Byte = bData;
+        ret = EEPROM_WriteBuffer_Async(bAdd, &EEPROM_Async_Byte, 1, WriteCompleteHandler);
+    }
+    return ret;
+}
+
+/**
+ * @brief Starts writing a buffer to the EEPROM and returns without waiting.
+ * 
+ * One byte is programmed per EEIF interrupt. Global interrupts are disabled only
+ * around the 0x55/0xAA unlock sequence. Every byte is read first and skipped if
+ * it already holds the new value, so rewriting unchanged data costs only reads.
+ * If no byte needs programming the handler is called before this returns,
+ * otherwise it is called from EEPROM_ISR. The handler may start the next write.
+ * 
+ * @param bAdd The EEPROM address of the first byte.
+ * @param bData Data to be written, must stay valid until the handler runs.
+ * @param len Number of bytes, bAdd + len must not pass the end of the EEPROM.
+ * @param WriteCompleteHandler Called once the whole buffer is written, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid buffer or range, or a write is still in progress.
+ */
+Std_ReturnType EEPROM_WriteBuffer_Async(uint16 bAdd, const uint8 *bData, uint16 len, void (*WriteCompleteHandler)(void)) {
+    Std_ReturnType ret = E_OK;
+
+    if ((NULL == bData) || (0 == len) || (bAdd >= EEPROM_DATA_SIZE) || (len > (EEPROM_DATA_SIZE - bAdd))) {
+        ret = E_NOT_OK;
+    } else if (EEPROM_Write_Busy || (INITIATE_EEPROM_DATA_WRITE_ERASE == EECON1bits.WR)) {
+        ret = E_NOT_OK;
+    } else {
+        EEPROM_Write_Busy = 1;
+        EEPROM_WriteCompleteHandler = WriteCompleteHandler;
+        EEPROM_Async_Address = bAdd;
+        EEPROM_Async_Data = bData;
+        EEPROM_Async_Remaining = len;
+
+        //Cleared before the first write so its EEIF is not lost
+        EEPROM_INTERRUPT_FLAG_CLEAR();
+        if (EEPROM_Async_Start_Next()) {
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+            //A write cycle takes milliseconds, it never needs the high priority vector
+            EEPROM_INT_LOW_PRIORITY();
+#endif
+            EEPROM_INTERRUPT_ENABLE();
+        } else {
+            //Every byte already matched, nothing was written
+            EEPROM_Write_Busy = 0;
+            if (WriteCompleteHandler) {
+                WriteCompleteHandler();
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reports whether an interrupt driven write cycle is still in progress.
+ * 
+ * @param busy A pointer to store 1 while a write is in progress, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_Is_Busy(uint8 *busy) {
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == busy) {
+        ret = E_NOT_OK;
+    } else {
+        *busy = EEPROM_Write_Busy;
+    }
+    return ret;
+}
+#endif
+
+//==================================================
+// Helper Functions
+//==================================================
+
+#if EEPROM_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Starts programming the next byte of the pending buffer that differs
+ *        from what the EEPROM already holds.
+ * 
+ * @return 1 if a write cycle was started, 0 if the buffer is done.
+ */
+static uint8 EEPROM_Async_Start_Next(void) {
+    uint8 Current_Data = 0;
+    uint8 Started = 0;
+
+    while (EEPROM_Async_Remaining && (0 == Started)) {
+        uint16 Address = EEPROM_Async_Address++;
+        uint8 Data = *EEPROM_Async_Data++;
+        EEPROM_Async_Remaining--;
+
+        //Read-before-write, a matching byte costs no write cycle and no wear
+        EEPROM_Read(Address, &Current_Data);
+        if (Current_Data != Data) {
+            EEPROM_Start_Write(Address, Data);
+            Started = 1;
+        }
+    }
+    return Started;
+}
+#endif
+
+/**
+ * @brief Reads one byte, the caller makes sure no write cycle is in progress.
+ * 
+ * @param bAdd The EEPROM address to read from.
+ * @param bData A pointer to store the read data.
+ */
+static void EEPROM_Read(uint16 bAdd, uint8 *bData) {
+    //Updates the Data Memory Address to read
+    EEADRH = (uint8) ((bAdd >> 8) & 0x03);
+    EEADR = (uint8) (bAdd & 0xFF);
+    //Access EEPROM
+    EECON1bits.EEPGD = ACCESS_EEPROM_MEMORY;
+    EECON1bits.CFGS = ACCESS_FLASH_EEPROM_MEMORY;
+    //Initiates an EEPROM read
+    EECON1bits.RD = INITIATE_EEPROM_DATA_READ;
+    NOP();
+    NOP();
+    //Reads data
+    *bData = EEDATA;
+}
+
+/**
+ * @brief Loads the address and data, then runs the unlock sequence and sets WR.
+ *        WREN is only set around the unlock sequence.
+ *        Returns as soon as the write cycle has started.
+ * 
+ * @param bAdd The EEPROM address to write at.
+ * @param bData Data to be written.
+ */
+static void EEPROM_Start_Write(uint16 bAdd, uint8 bData) {
     //Reads the Interrupt Status "enabled or disabled"
     uint8 Global_Interrupt_Status = INTCONbits.GIE;
 
@@ -43,7 +267,7 @@ Std_ReturnType EEPROM_WriteByte(uint16 bAdd, uint8 bData) {
     //Allows write cycles to Flash program/data EEPROM
     EECON1bits.WREN = ALLOW_WRITE_CYCLES;
 
-    //Disable all interrupts
+    //Disable all interrupts, the unlock sequence must not be interrupted
     INTCONbits.GIE = INTERRUPT_DISABLE;
 
     //Write the required seq 
@@ -53,45 +277,35 @@ Std_ReturnType EEPROM_WriteByte(uint16 bAdd, uint8 bData) {
     //Initiates a data EEPROM erase/write cycle
     EECON1bits.WR = INITIATE_EEPROM_DATA_WRITE_ERASE;
 
-    //Wait for a while unitl write is completed
-    while (INITIATE_EEPROM_DATA_WRITE_ERASE == EECON1bits.WR);
-
-    //Inhibits write cycles to Flash program/data EEPROM
+    //Inhibits write cycles again, the cycle already started is not affected
     EECON1bits.WREN = INHIBITS_WRITE_CYCLES;
 
     //Restores the Interrupt Status "enabled or disabled"
     INTCONbits.GIE = Global_Interrupt_Status;
-
-    return ret;
 }
 
+//==================================================
+// ISR Functions
+//==================================================
+
 /**
- * @brief Reads one byte of data from a specific EEPROM Address.
+ * @brief The data EEPROM write complete interrupt MCAL helper function
  * 
- * @param bAdd The EEPROM address to read from..
- * @param bData A pointer to store the read data.
- * @return Std_ReturnType A status indicating the success or failure of the operation.
- *         - E_OK: The operation was successful.
- *         - E_NOT_OK: An error occurred during the operation.
  */
-Std_ReturnType EEPROM_ReadByte(uint16 bAdd, uint8 *bData) {
-    Std_ReturnType ret = E_OK;
+void EEPROM_ISR(void) {
+#if EEPROM_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    //The write cycle is over, the flag must be cleared.
+    EEPROM_INTERRUPT_FLAG_CLEAR();
 
-    if (NULL == bData) {
-        ret = E_NOT_OK;
-    } else {
-        //Updates the Data Memory Address to read
-        EEADRH = (uint8) ((bAdd >> 8) & 0x03);
-        EEADR = (uint8) (bAdd & 0xFF);
-        //Access EEPROM
-        EECON1bits.EEPGD = ACCESS_EEPROM_MEMORY;
-        EECON1bits.CFGS = ACCESS_FLASH_EEPROM_MEMORY;
-        //Initiates an EEPROM read
-        EECON1bits.RD = INITIATE_EEPROM_DATA_READ;
-        NOP();
-        NOP();
-        //Reads data
-        *bData = EEDATA;
+    //Move on to the next byte that needs programming
+    if (0 == EEPROM_Async_Start_Next()) {
+        EEPROM_INTERRUPT_DISABLE();
+        EEPROM_Write_Busy = 0;
+
+        //CallBack func gets called once the whole buffer is written.
+        if (EEPROM_WriteCompleteHandler) {
+            EEPROM_WriteCompleteHandler();
+        }
     }
-    return ret;
-}
\ No newline at end of file
+#endif
+}
@@ -30,6 +30,8 @@
 
 #define INITIATE_EEPROM_DATA_READ          1
 
+#define EEPROM_DATA_SIZE                   1024U
+
 //==================================================
 // Macro Functions Declarations 
 //==================================================
@@ -59,9 +61,55 @@ Std_ReturnType EEPROM_WriteByte(uint16 bAdd, uint8 bData);
  * @param bData A pointer to store the read data.
  * @return Std_ReturnType A status indicating the success or failure of the operation.
  *         - E_OK: The operation was successful.
- *         - E_NOT_OK: An error occurred during the operation.
+ *         - E_NOT_OK: A NULL pointer, or a write is in progress.
  */
 Std_ReturnType EEPROM_ReadByte(uint16 bAdd, uint8 *bData);
 
+#if EEPROM_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Starts writing one byte of data to a specific EEPROM Address and returns
+ *        without waiting for the ~4 ms write cycle.
+ * 
+ * Same as EEPROM_WriteBuffer_Async() with a one byte buffer, the byte is copied.
+ * 
+ * @param bAdd The EEPROM address to write at.
+ * @param bData Data to be written.
+ * @param WriteCompleteHandler Called once the byte is written, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A write is still in progress.
+ */
+Std_ReturnType EEPROM_WriteByte_Async(uint16 bAdd, uint8 bData, void (*WriteCompleteHandler)(void));
+
+/**
+ * @brief Starts writing a buffer to the EEPROM and returns without waiting.
+ * 
+ * One byte is programmed per EEIF interrupt. Global interrupts are disabled only
+ * around the 0x55/0xAA unlock sequence. Every byte is read first and skipped if
+ * it already holds the new value, so rewriting unchanged data costs only reads.
+ * If no byte needs programming the handler is called before this returns,
+ * otherwise it is called from EEPROM_ISR. The handler may start the next write.
+ * 
+ * @param bAdd The EEPROM address of the first byte.
+ * @param bData Data to be written, must stay valid until the handler runs.
+ * @param len Number of bytes, bAdd + len must not pass the end of the EEPROM.
+ * @param WriteCompleteHandler Called once the whole buffer is written, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid buffer or range, or a write is still in progress.
+ */
+Std_ReturnType EEPROM_WriteBuffer_Async(uint16 bAdd, const uint8 *bData, uint16 len, void (*WriteCompleteHandler)(void));
+
+/**
+ * @brief Reports whether an interrupt driven write cycle is still in progress.
+ * 
+ * @param busy A pointer to store 1 while a write is in progress, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_Is_Busy(uint8 *busy);
+#endif
+
 #endif	/* EEPROM_H */
 
@@ -333,4 +333,233 @@ Std_ReturnType gpio_port_read(port_index_t port, uint8 *value)
 
     return ret;
 }
+
+/**
+ * @brief Writes the bits of a GPIO port selected by a mask, leaving the others.
+ * 
+ * The LAT register is updated with a single write, interrupts are masked for the
+ * read-modify-write so an ISR changing other bits of the port is not undone.
+ * 
+ * @param port The index of the port to write to.
+ * @param mask The bits of the port to change.
+ * @param value The logic values, in port bit positions, bits outside mask are ignored.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *          - E_OK: The operation was successful.
+ *          - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType gpio_port_write_masked(port_index_t port, uint8 mask, uint8 value)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(port > PORT_MAX_NUM - 1)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        volatile uint8 *lat = lat_registers[port];
+        uint8 Global_Interrupt_Status = INTCONbits.GIE;
+
+        INTCONbits.GIE = 0;
+        *lat = (uint8)((*lat & (uint8)~mask) | (value & mask));
+        INTCONbits.GIE = Global_Interrupt_Status;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Builds a pin group from an array of pin configurations.
+ * 
+ * Only the port and pin number of each pin are used, directions are left as
+ * they are. Pins on one port in ascending order (pin n at bit shift + n) take
+ * a shift-and-mask fast path.
+ * 
+ * @param group A pointer to the group to fill.
+ * @param pins The pins, pins[n] becomes bit n of the group values.
+ * @param count Number of pins, 1 to GPIO_PIN_GROUP_MAX_PINS.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *          - E_OK: The operation was successful.
+ *          - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType gpio_pin_group_init(gpio_pin_group_t *group, const pin_config_t *pins, uint8 count)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == group || NULL == pins || 0 == count || count > GPIO_PIN_GROUP_MAX_PINS)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        group->count = count;
+        group->ports = 0;
+        group->contiguous = 1;
+        group->port = pins[0].port;
+        group->mask = 0;
+        group->shift = pins[0].pin_num;
+
+        for(uint8 index = 0; index < count; index++)
+        {
+            if(pins[index].port > PORT_MAX_NUM - 1)
+            {
+                ret = E_NOT_OK;
+                break;
+            }
+            group->map[index] = (uint8)((pins[index].port << 3) | pins[index].pin_num);
+            group->ports |= (uint8)(BIT_MASK << pins[index].port);
+            if(pins[index].port != group->port || pins[index].pin_num != group->shift + index)
+            {
+                group->contiguous = 0;
+            }
+            group->mask |= (uint8)(BIT_MASK << pins[index].pin_num);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Writes a value to a pin group.
+ * 
+ * Every port the group uses gets one gpio_port_write_masked(). A group spanning
+ * ports is updated one port after the other.
+ * 
+ * @param group A pointer to the group.
+ * @param value Bit n drives pin n of the group, higher bits are ignored.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *          - E_OK: The operation was successful.
+ *          - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType gpio_pin_group_write(const gpio_pin_group_t *group, uint8 value)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == group)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(group->contiguous)
+    {
+        ret = gpio_port_write_masked(group->port, group->mask, (uint8)(value << group->shift));
+    }
+    else
+    {
+        uint8 port_mask[PORT_MAX_NUM] = {0};
+        uint8 port_value[PORT_MAX_NUM] = {0};
+
+        /* Gather the bits of each port first, then touch each LAT once */
+        for(uint8 index = 0; index < group->count; index++)
+        {
+            uint8 port = group->map[index] >> 3;
+            uint8 bit = (uint8)(BIT_MASK << (group->map[index] & 0x07));
+
+            port_mask[port] |= bit;
+            if(value & (BIT_MASK << index))
+            {
+                port_value[port] |= bit;
+            }
+        }
+        for(uint8 port = 0; port < PORT_MAX_NUM; port++)
+        {
+            if(port_mask[port])
+            {
+                ret = gpio_port_write_masked(port, port_mask[port], port_value[port]);
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Reads the levels of a pin group.
+ * 
+ * Each port register the group uses is read once, other ports are not touched.
+ * 
+ * @param group A pointer to the group.
+ * @param value A pointer to store the levels, bit n is pin n of the group.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *          - E_OK: The operation was successful.
+ *          - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType gpio_pin_group_read(const gpio_pin_group_t *group, uint8 *value)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == group || NULL == value)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(group->contiguous)
+    {
+        *value = (uint8)((*port_registers[group->port] & group->mask) >> group->shift);
+    }
+    else
+    {
+        uint8 levels[PORT_MAX_NUM] = {0};
+        uint8 result = 0;
+
+        /* Reading PORTB ends an RBx mismatch, so unused ports are left alone */
+        for(uint8 port = 0; port < PORT_MAX_NUM; port++)
+        {
+            if(group->ports & (BIT_MASK << port))
+            {
+                levels[port] = *port_registers[port];
+            }
+        }
+        for(uint8 index = 0; index < group->count; index++)
+        {
+            if(levels[group->map[index] >> 3] & (BIT_MASK << (group->map[index] & 0x07)))
+            {
+                result |= (uint8)(BIT_MASK << index);
+            }
+        }
+        *value = result;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Sets the direction of every pin of a group, one TRIS write per port.
+ * 
+ * @param group A pointer to the group.
+ * @param direction The direction for all the pins of the group.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *          - E_OK: The operation was successful.
+ *          - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType gpio_pin_group_set_direction(const gpio_pin_group_t *group, direction_t direction)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == group || direction > GPIO_DIRECTION_INPUT)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        uint8 port_mask[PORT_MAX_NUM] = {0};
+
+        for(uint8 index = 0; index < group->count; index++)
+        {
+            port_mask[group->map[index] >> 3] |= (uint8)(BIT_MASK << (group->map[index] & 0x07));
+        }
+        for(uint8 port = 0; port < PORT_MAX_NUM; port++)
+        {
+            if(port_mask[port])
+            {
+                volatile uint8 *tris = tris_registers[port];
+                uint8 Global_Interrupt_Status = INTCONbits.GIE;
+
+                INTCONbits.GIE = 0;
+                *tris = (GPIO_DIRECTION_INPUT == direction) ? (uint8)(*tris | port_mask[port]) : (uint8)(*tris & (uint8)~port_mask[port]);
+                INTCONbits.GIE = Global_Interrupt_Status;
+            }
+        }
+    }
+
+    return ret;
+}
 #endif /* GPIO_PORT_PIN_CONFIGURATION */
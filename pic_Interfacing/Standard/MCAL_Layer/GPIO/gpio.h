@@ -31,6 +31,8 @@
 #define PORT_MAX_NUM        5
 #define PORT_MASK           0xFF
 
+#define GPIO_PIN_GROUP_MAX_PINS       8
+
 #define GPIO_PORT_PIN_CONFIGURATION   CONFIG_ENABLE
 #define GPIO_PORT_CONFIGURATION       CONFIG_ENABLE
 
@@ -47,6 +49,47 @@
 #define IS_BIT_SET(REG,BIT_POS)  ((REG & (BIT_MASK << BIT_POS)) >> BIT_POS)
 #define IS_BIT_CLR(REG,BIT_POS)  (!((REG & (BIT_MASK << BIT_POS)) >> BIT_POS))
 
+/*
+ * Compile-time pin binding, for pins fixed at build time. A pin is named once by
+ * its port letter and pin number and used through the GPIO_FAST_PIN_* macros:
+ *
+ *     #define LED_STATUS_PIN      GPIO_PIN_ID(C, 2)
+ *     GPIO_FAST_PIN_OUTPUT(LED_STATUS_PIN);
+ *     GPIO_FAST_PIN_TOGGLE(LED_STATUS_PIN);
+ *
+ * Register and mask are constants, so HIGH/LOW/TOGGLE compile to one BSF/BCF/BTG
+ * on LATx, with no NULL or bounds check, no switch and no lat_registers[] lookup.
+ * A single bit instruction is also atomic against ISRs touching the same port.
+ * There is no checking: a wrong letter or pin fails to compile or to do anything.
+ * pin_config_t and the gpio_pin_* functions stay for pins chosen at run time,
+ * GPIO_PIN_CONFIG() builds one from the same binding.
+ */
+#define GPIO_PIN_ID(_PORT, _PIN)                        _PORT, _PIN
+
+#define GPIO_FAST_PIN_HIGH(_PIN_ID)                     GPIO_FAST_PIN_HIGH_(_PIN_ID)
+#define GPIO_FAST_PIN_LOW(_PIN_ID)                      GPIO_FAST_PIN_LOW_(_PIN_ID)
+#define GPIO_FAST_PIN_TOGGLE(_PIN_ID)                   GPIO_FAST_PIN_TOGGLE_(_PIN_ID)
+/* Two bit instructions behind a test of _LOGIC, a constant _LOGIC folds to one */
+#define GPIO_FAST_PIN_WRITE(_PIN_ID, _LOGIC)            GPIO_FAST_PIN_WRITE_(_PIN_ID, _LOGIC)
+/* Reads the PORTx pin level as GPIO_LOW or GPIO_HIGH */
+#define GPIO_FAST_PIN_READ(_PIN_ID)                     GPIO_FAST_PIN_READ_(_PIN_ID)
+#define GPIO_FAST_PIN_OUTPUT(_PIN_ID)                   GPIO_FAST_PIN_OUTPUT_(_PIN_ID)
+#define GPIO_FAST_PIN_INPUT(_PIN_ID)                    GPIO_FAST_PIN_INPUT_(_PIN_ID)
+/* pin_config_t initializer for handing a bound pin to the runtime API */
+#define GPIO_PIN_CONFIG(_PIN_ID, _DIRECTION, _LOGIC)    GPIO_PIN_CONFIG_(_PIN_ID, _DIRECTION, _LOGIC)
+
+/* The wrappers above expand _PIN_ID into its port and pin before these see it */
+#define GPIO_FAST_PIN_MASK_(_PIN)                       ((uint8)(BIT_MASK << (_PIN)))
+#define GPIO_FAST_PIN_HIGH_(_PORT, _PIN)                (LAT##_PORT |= GPIO_FAST_PIN_MASK_(_PIN))
+#define GPIO_FAST_PIN_LOW_(_PORT, _PIN)                 (LAT##_PORT &= (uint8)~GPIO_FAST_PIN_MASK_(_PIN))
+#define GPIO_FAST_PIN_TOGGLE_(_PORT, _PIN)              (LAT##_PORT ^= GPIO_FAST_PIN_MASK_(_PIN))
+#define GPIO_FAST_PIN_WRITE_(_PORT, _PIN, _LOGIC)       ((_LOGIC) ? GPIO_FAST_PIN_HIGH_(_PORT, _PIN) : GPIO_FAST_PIN_LOW_(_PORT, _PIN))
+#define GPIO_FAST_PIN_READ_(_PORT, _PIN)                ((uint8)((PORT##_PORT >> (_PIN)) & BIT_MASK))
+#define GPIO_FAST_PIN_OUTPUT_(_PORT, _PIN)              (TRIS##_PORT &= (uint8)~GPIO_FAST_PIN_MASK_(_PIN))
+#define GPIO_FAST_PIN_INPUT_(_PORT, _PIN)               (TRIS##_PORT |= GPIO_FAST_PIN_MASK_(_PIN))
+#define GPIO_PIN_CONFIG_(_PORT, _PIN, _DIRECTION, _LOGIC) \
+    {.port = PORT##_PORT##_INDEX, .pin_num = PIN##_PIN, .direction = (_DIRECTION), .logic = (_LOGIC)}
+
 //==================================================
 // Data Types Declarations
 //==================================================
@@ -91,6 +134,23 @@ typedef struct
     uint8 logic : 1;        // @ref logic_t
 } pin_config_t;
 
+/*
+ * Pins written and read together as one value, bit n of the value is pin n of
+ * the group. Filled by gpio_pin_group_init() from a pin_config_t array, which
+ * is not referenced afterwards. Each port is updated with one LAT write, so the
+ * pins of a port never show a mix of the old and the new value.
+ */
+typedef struct
+{
+    uint8 map[GPIO_PIN_GROUP_MAX_PINS];  // Bit n: (port << 3) | pin number
+    uint8 count;                         // Number of pins, 1 to GPIO_PIN_GROUP_MAX_PINS
+    uint8 ports;                         // Bit p set when a pin is on port_index_t p
+    uint8 contiguous;                    // 1 when pin n is bit shift + n of one port
+    uint8 port;                          // @ref port_index_t, used when contiguous
+    uint8 mask;                          // LAT bits of the group, used when contiguous
+    uint8 shift;                         // Pin number of bit 0, used when contiguous
+} gpio_pin_group_t;
+
 //==================================================
 // Functions Declarations
 //==================================================
@@ -245,5 +305,74 @@ Std_ReturnType gpio_port_read(port_index_t port, uint8 *logic);
  */
 Std_ReturnType gpio_port_toggle(port_index_t port);
 
+/**
+ * @brief Writes the bits of a GPIO port selected by a mask, leaving the others.
+ * 
+ * The LAT register is updated with a single write, interrupts are masked for the
+ * read-modify-write so an ISR changing other bits of the port is not undone.
+ * 
+ * @param port The index of the port to write to.
+ * @param mask The bits of the port to change.
+ * @param value The logic values, in port bit positions, bits outside mask are ignored.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *          - E_OK: The operation was successful.
+ *          - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType gpio_port_write_masked(port_index_t port, uint8 mask, uint8 value);
+
+/**
+ * @brief Builds a pin group from an array of pin configurations.
+ * 
+ * Only the port and pin number of each pin are used, directions are left as
+ * they are. Pins on one port in ascending order (pin n at bit shift + n) take
+ * a shift-and-mask fast path.
+ * 
+ * @param group A pointer to the group to fill.
+ * @param pins The pins, pins[n] becomes bit n of the group values.
+ * @param count Number of pins, 1 to GPIO_PIN_GROUP_MAX_PINS.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *          - E_OK: The operation was successful.
+ *          - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType gpio_pin_group_init(gpio_pin_group_t *group, const pin_config_t *pins, uint8 count);
+
+/**
+ * @brief Writes a value to a pin group.
+ * 
+ * Every port the group uses gets one gpio_port_write_masked(). A group spanning
+ * ports is updated one port after the other.
+ * 
+ * @param group A pointer to the group.
+ * @param value Bit n drives pin n of the group, higher bits are ignored.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *          - E_OK: The operation was successful.
+ *          - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType gpio_pin_group_write(const gpio_pin_group_t *group, uint8 value);
+
+/**
+ * @brief Reads the levels of a pin group.
+ * 
+ * Each port register the group uses is read once, other ports are not touched.
+ * 
+ * @param group A pointer to the group.
+ * @param value A pointer to store the levels, bit n is pin n of the group.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *          - E_OK: The operation was successful.
+ *          - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType gpio_pin_group_read(const gpio_pin_group_t *group, uint8 *value);
+
+/**
+ * @brief Sets the direction of every pin of a group, one TRIS write per port.
+ * 
+ * @param group A pointer to the group.
+ * @param direction The direction for all the pins of the group.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *          - E_OK: The operation was successful.
+ *          - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType gpio_pin_group_set_direction(const gpio_pin_group_t *group, direction_t direction);
+
 #endif	/* GPIO_H */
 
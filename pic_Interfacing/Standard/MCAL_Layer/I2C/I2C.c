@@ -16,11 +16,37 @@
 #if I2C_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
 static void (*I2C_InterruptHandler)(void) = NULL;
 static void (*I2C_Interrupt_Write_Col)(void) = NULL;
+
+/* Interrupt-driven master, each state waits for the SSPIF of the step it started */
+typedef enum {
+    I2C_MASTER_STATE_IDLE = 0,
+    I2C_MASTER_STATE_START,         /* Start condition */
+    I2C_MASTER_STATE_WRITE,         /* Address+W or a data byte */
+    I2C_MASTER_STATE_RESTART,       /* Repeated start condition */
+    I2C_MASTER_STATE_ADDRESS_READ,  /* Address+R */
+    I2C_MASTER_STATE_RECEIVE,       /* A data byte clocked in */
+    I2C_MASTER_STATE_ACK,           /* ACK/NACK sequence */
+    I2C_MASTER_STATE_STOP           /* Stop condition */
+} i2c_master_state_t;
+
+static i2c_transaction_t *i2c_master_queue[I2C_MASTER_QUEUE_SIZE];
+static volatile uint8 i2c_master_queue_head = ZERO_INIT;
+static volatile uint8 i2c_master_queue_count = ZERO_INIT;
+static volatile i2c_master_state_t i2c_master_state = I2C_MASTER_STATE_IDLE;
+static i2c_transaction_status_t i2c_master_result = I2C_TRANSACTION_DONE;
+static uint8 i2c_master_index = ZERO_INIT;
+
+static void I2C_Master_Start_Next(void);
+static void I2C_Master_Stop_With(i2c_transaction_status_t result);
+static void I2C_Master_Complete(i2c_transaction_status_t result);
+static void I2C_Master_Engine(void);
 #endif
 
 static void inline I2C_Gpio_Configurations();
 static void inline I2C_Interrupt_Configure(const I2C_t *_i2c);
 static Std_ReturnType inline I2C_Slave_Mode_Select(const I2C_t *_i2c);
+static Std_ReturnType I2C_Master_Transmit_Bytes(uint8 address, const uint8 *data, uint8 len);
+static void I2C_Master_Receive_Bytes(uint8 *data, uint8 len);
 
 //==================================================
 // Function definitions
@@ -259,13 +285,16 @@ Std_ReturnType I2C_Master_Transmit(uint8 data, uint8 *_ack) {
     if (NULL == _ack) {
         ret = E_NOT_OK;
     } else {
+        PIR1bits.SSPIF = 0; /* Clear The Interrupt flag, it marks the end of this byte */
         SSPBUF = data;
         //Checks if SSPBUF register is written while it is still transmitting the previous word.
         if (I2C_TRANSMIT_COLLISION_CHECK() == I2C_WRITE_COLLISION_OCCURRED) {
             I2C_TRANSMIT_COLLISION_CLEAR();
             SSPBUF = data;
         }
-        while (I2C_BUFFER_STATUS()); /* Waits until the transmission is complete. */
+        while (I2C_BUFFER_STATUS()); /* Waits until the 8 data bits are out. */
+        //BF clears before the 9th clock, ACKSTAT is only valid once SSPIF is set
+        while (!PIR1bits.SSPIF);
         PIR1bits.SSPIF = 0; /* Clear The Interrupt flag */
         if (I2C_ACK == I2C_MASTER_ACK_CHECK()) {
             *_ack = I2C_ACK;
@@ -311,7 +340,7 @@ Std_ReturnType I2C_Master_Transmit(uint8 data, uint8 *_ack) {
             I2C_MASTER_RECEIVE_NACK(); /* Not Acknowledge */
         }
         I2C_MASTER_RECEIVE_INITIATE_ACK_SEQ(); /* Initiate Acknowledge sequence on SDA and SCL pins and transmit ACKDT data bit */
-        __delay_us(200);
+        while (SSPCON2bits.ACKEN); /* Waits until the acknowledge sequence is over */
     }
     return ret;
 }
@@ -401,10 +430,319 @@ Std_ReturnType I2C_Master_Send_1Byte(uint8 slave_address, uint8 data, uint8 *_ac
     return ret;
 }
 
+/**
+ * @brief Writes a buffer to a slave in master mode via the I2C communication.
+ * 
+ * Sends start, the address with the write bit, len data bytes and stop in one call.
+ * The transfer is cut short with a stop as soon as the slave NACKs a byte.
+ * 
+ * @param slave_address The 7-bit address of the target slave device.
+ * @param data A pointer to the bytes to be transmitted.
+ * @param len Number of bytes to transmit.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: All bytes were acknowledged.
+ *         - E_NOT_OK: Null pointer, or the slave did not acknowledge.
+ */
+Std_ReturnType I2C_Master_WriteBuffer(uint8 slave_address, const uint8 *data, uint8 len) {
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == data) {
+        ret = E_NOT_OK;
+    } else {
+        I2C_Master_Send_Start();
+        ret = I2C_Master_Transmit_Bytes((uint8) ((slave_address << 1) | I2C_WRITE_OPPERATION), data, len);
+        I2C_Master_Send_Stop();
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads a buffer from a slave in master mode via the I2C communication.
+ * 
+ * Sends start and the address with the read bit, then clocks in len bytes,
+ * acknowledging every byte but the last one which gets a NACK, then stop.
+ * 
+ * @param slave_address The 7-bit address of the target slave device.
+ * @param data A pointer to store the received bytes.
+ * @param len Number of bytes to receive.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer, zero length, or the slave did not acknowledge its address.
+ */
+Std_ReturnType I2C_Master_ReadBuffer(uint8 slave_address, uint8 *data, uint8 len) {
+    Std_ReturnType ret = E_OK;
+
+    if ((NULL == data) || (0 == len)) {
+        ret = E_NOT_OK;
+    } else {
+        I2C_Master_Send_Start();
+        ret = I2C_Master_Transmit_Bytes((uint8) ((slave_address << 1) | I2C_READ_OPPERATION), NULL, 0);
+        if (E_OK == ret) {
+            I2C_Master_Receive_Bytes(data, len);
+        }
+        I2C_Master_Send_Stop();
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes then reads a slave in one transfer via the I2C communication.
+ * 
+ * Typical register access: the register pointer is written, then a repeated start
+ * turns the bus around and rlen bytes are read, the last one with a NACK, then stop.
+ * 
+ * @param slave_address The 7-bit address of the target slave device.
+ * @param wdata A pointer to the bytes to write first (register pointer).
+ * @param wlen Number of bytes to write.
+ * @param rdata A pointer to store the received bytes.
+ * @param rlen Number of bytes to receive.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer, zero read length, or the slave did not acknowledge.
+ */
+Std_ReturnType I2C_Master_WriteRead(uint8 slave_address, const uint8 *wdata, uint8 wlen, uint8 *rdata, uint8 rlen) {
+    Std_ReturnType ret = E_OK;
+
+    if (((NULL == wdata) && (0 != wlen)) || (NULL == rdata) || (0 == rlen)) {
+        ret = E_NOT_OK;
+    } else {
+        I2C_Master_Send_Start();
+        ret = I2C_Master_Transmit_Bytes((uint8) ((slave_address << 1) | I2C_WRITE_OPPERATION), wdata, wlen);
+        if (E_OK == ret) {
+            I2C_Master_Send_Repeated_Start();
+            ret = I2C_Master_Transmit_Bytes((uint8) ((slave_address << 1) | I2C_READ_OPPERATION), NULL, 0);
+        }
+        if (E_OK == ret) {
+            I2C_Master_Receive_Bytes(rdata, rlen);
+        }
+        I2C_Master_Send_Stop();
+    }
+    return ret;
+}
+
+#if I2C_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Queues a master transaction to be run from I2C_ISR.
+ * 
+ * The transaction starts right away if the bus is idle, otherwise when the ones
+ * before it have completed. Its status moves to DONE, NACK or BUS_COLLISION
+ * and its callback (if any) is called from the ISR once the stop condition is out.
+ * The MSSP must have been initialized in I2C_MASTER_DEFINED_CLOCK mode.
+ * 
+ * @param transaction A pointer to the transaction descriptor.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The transaction was queued.
+ *         - E_NOT_OK: Null pointer or the queue is full.
+ */
+Std_ReturnType I2C_Master_Queue_Transaction(i2c_transaction_t *transaction) {
+    Std_ReturnType ret = E_OK;
+    uint8 tail = ZERO_INIT;
+
+    if ((NULL == transaction) || ((0 != transaction->write_len) && (NULL == transaction->write_buf))
+            || ((0 != transaction->read_len) && (NULL == transaction->read_buf))) {
+        ret = E_NOT_OK;
+    } else {
+        //Keep the ISR away while the queue is updated, SSPIE is put back as it was
+        uint8 I2C_Interrupt_Status = PIE1bits.SSPIE;
+        I2C_INTERRUPT_DISABLE();
+        if (I2C_MASTER_QUEUE_SIZE <= i2c_master_queue_count) {
+            ret = E_NOT_OK;
+        } else {
+            tail = (uint8) (i2c_master_queue_head + i2c_master_queue_count);
+            if (tail >= I2C_MASTER_QUEUE_SIZE) {
+                tail -= I2C_MASTER_QUEUE_SIZE;
+            }
+            transaction->status = I2C_TRANSACTION_PENDING;
+            i2c_master_queue[tail] = transaction;
+            i2c_master_queue_count++;
+            if (I2C_MASTER_STATE_IDLE == i2c_master_state) {
+                I2C_Master_Start_Next();
+            }
+        }
+        PIE1bits.SSPIE = I2C_Interrupt_Status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Checks whether the interrupt-driven master has work in progress.
+ * 
+ * @param busy A pointer to store I2C_MASTER_BUSY or I2C_MASTER_IDLE.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType I2C_Master_Is_Busy(uint8 *busy) {
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == busy) {
+        ret = E_NOT_OK;
+    } else {
+        *busy = (I2C_MASTER_STATE_IDLE == i2c_master_state) ? I2C_MASTER_IDLE : I2C_MASTER_BUSY;
+    }
+    return ret;
+}
+#endif
+
 //==================================================
 // Static functions definitions
 //==================================================
 
+/**
+ * @brief Sends the address byte then len data bytes, stops at the first NACK.
+ * @return E_OK if every byte was acknowledged.
+ */
+static Std_ReturnType I2C_Master_Transmit_Bytes(uint8 address, const uint8 *data, uint8 len) {
+    Std_ReturnType ret = E_OK;
+    uint8 ack = I2C_ACK;
+    uint8 i = ZERO_INIT;
+
+    I2C_Master_Transmit(address, &ack);
+    for (i = 0; (I2C_ACK == ack) && (i < len); i++) {
+        I2C_Master_Transmit(data[i], &ack);
+    }
+    if (I2C_ACK != ack) {
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Clocks in len bytes, ACKs all of them but the last one.
+ */
+static void I2C_Master_Receive_Bytes(uint8 *data, uint8 len) {
+    uint8 i = ZERO_INIT;
+
+    for (i = 0; i < len; i++) {
+        I2C_MASTER_RECEIVE_MODE_ENABLE();
+        while (!I2C_BUFFER_STATUS()); /* Waits until the reception is complete */
+        data[i] = SSPBUF;
+        if ((uint8) (i + 1) < len) {
+            I2C_MASTER_RECEIVE_ACK();
+        } else {
+            I2C_MASTER_RECEIVE_NACK();
+        }
+        I2C_MASTER_RECEIVE_INITIATE_ACK_SEQ();
+        while (SSPCON2bits.ACKEN); /* Waits until the acknowledge sequence is over */
+    }
+    PIR1bits.SSPIF = 0; /* Clear The Interrupt flag */
+}
+
+#if I2C_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Puts the transaction at the head of the queue on the bus.
+ */
+static void I2C_Master_Start_Next(void) {
+    i2c_master_queue[i2c_master_queue_head]->status = I2C_TRANSACTION_BUSY;
+    i2c_master_index = ZERO_INIT;
+    i2c_master_state = I2C_MASTER_STATE_START;
+    I2C_INITIATE_START_CONDITION();
+}
+
+/**
+ * @brief Ends the current transaction with a stop condition, the result is reported once it is out.
+ */
+static void I2C_Master_Stop_With(i2c_transaction_status_t result) {
+    i2c_master_result = result;
+    i2c_master_state = I2C_MASTER_STATE_STOP;
+    I2C_INITIATE_STOP_CONDITION();
+}
+
+/**
+ * @brief Reports the head transaction, removes it from the queue and starts the next one.
+ */
+static void I2C_Master_Complete(i2c_transaction_status_t result) {
+    i2c_transaction_t *transaction = i2c_master_queue[i2c_master_queue_head];
+
+    i2c_master_queue_head++;
+    if (i2c_master_queue_head >= I2C_MASTER_QUEUE_SIZE) {
+        i2c_master_queue_head = ZERO_INIT;
+    }
+    i2c_master_queue_count--;
+    transaction->status = result;
+    //The callback may queue the next transaction, it is picked up below
+    if (transaction->callback) {
+        transaction->callback(transaction);
+    }
+    if (ZERO_INIT != i2c_master_queue_count) {
+        I2C_Master_Start_Next();
+    } else {
+        i2c_master_state = I2C_MASTER_STATE_IDLE;
+    }
+}
+
+/**
+ * @brief Moves the current transaction one step forward, called on every SSPIF.
+ */
+static void I2C_Master_Engine(void) {
+    i2c_transaction_t *transaction = i2c_master_queue[i2c_master_queue_head];
+
+    switch (i2c_master_state) {
+        case I2C_MASTER_STATE_START:
+            if ((0 != transaction->write_len) || (0 == transaction->read_len)) {
+                SSPBUF = (uint8) ((transaction->slave_address << 1) | I2C_WRITE_OPPERATION);
+                i2c_master_state = I2C_MASTER_STATE_WRITE;
+            } else {
+                SSPBUF = (uint8) ((transaction->slave_address << 1) | I2C_READ_OPPERATION);
+                i2c_master_state = I2C_MASTER_STATE_ADDRESS_READ;
+            }
+            break;
+        case I2C_MASTER_STATE_WRITE:
+            if (I2C_NOT_ACK == I2C_MASTER_ACK_CHECK()) {
+                I2C_Master_Stop_With(I2C_TRANSACTION_NACK);
+            } else if (i2c_master_index < transaction->write_len) {
+                SSPBUF = transaction->write_buf[i2c_master_index];
+                i2c_master_index++;
+            } else if (0 != transaction->read_len) {
+                i2c_master_state = I2C_MASTER_STATE_RESTART;
+                I2C_INITIATE_REPEATED_START_CONDITION();
+            } else {
+                I2C_Master_Stop_With(I2C_TRANSACTION_DONE);
+            }
+            break;
+        case I2C_MASTER_STATE_RESTART:
+            SSPBUF = (uint8) ((transaction->slave_address << 1) | I2C_READ_OPPERATION);
+            i2c_master_state = I2C_MASTER_STATE_ADDRESS_READ;
+            break;
+        case I2C_MASTER_STATE_ADDRESS_READ:
+            if (I2C_NOT_ACK == I2C_MASTER_ACK_CHECK()) {
+                I2C_Master_Stop_With(I2C_TRANSACTION_NACK);
+            } else {
+                i2c_master_index = ZERO_INIT;
+                i2c_master_state = I2C_MASTER_STATE_RECEIVE;
+                I2C_MASTER_RECEIVE_MODE_ENABLE();
+            }
+            break;
+        case I2C_MASTER_STATE_RECEIVE:
+            transaction->read_buf[i2c_master_index] = SSPBUF;
+            i2c_master_index++;
+            //ACK every byte but the last one, the NACK tells the slave to release SDA
+            if (i2c_master_index < transaction->read_len) {
+                I2C_MASTER_RECEIVE_ACK();
+            } else {
+                I2C_MASTER_RECEIVE_NACK();
+            }
+            i2c_master_state = I2C_MASTER_STATE_ACK;
+            I2C_MASTER_RECEIVE_INITIATE_ACK_SEQ();
+            break;
+        case I2C_MASTER_STATE_ACK:
+            if (i2c_master_index < transaction->read_len) {
+                i2c_master_state = I2C_MASTER_STATE_RECEIVE;
+                I2C_MASTER_RECEIVE_MODE_ENABLE();
+            } else {
+                I2C_Master_Stop_With(I2C_TRANSACTION_DONE);
+            }
+            break;
+        case I2C_MASTER_STATE_STOP:
+            I2C_Master_Complete(i2c_master_result);
+            break;
+        default:
+            break;
+    }
+}
+#endif
+
+
 /**
  * @brief Helper function to Select Master Mode  
  *   Options:
@@ -487,6 +825,12 @@ void I2C_ISR() {
 #if I2C_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
     //MSSP I2C interrupt occurred, the flag must be cleared.
     I2C_INTERRUPT_FLAG_CLEAR();
+    //Advance the queued master transaction, if any.
+    if (I2C_MASTER_STATE_IDLE != i2c_master_state) {
+        I2C_Master_Engine();
+    } else {
+        /* Nothing */
+    }
     //CallBack func gets called every time this ISR executes.
     if (I2C_InterruptHandler) {
         I2C_InterruptHandler();
@@ -504,6 +848,12 @@ void I2C_BUS_COL_ISR() {
 #if I2C_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
     //MSSP I2C interrupt occurred, the flag must be cleared
     I2C_BUS_COL_INTERRUPT_FLAG_CLEAR();
+    //The MSSP drops back to idle on a collision, abort the queued transaction.
+    if (I2C_MASTER_STATE_IDLE != i2c_master_state) {
+        I2C_Master_Complete(I2C_TRANSACTION_BUS_COLLISION);
+    } else {
+        /* Nothing */
+    }
     //CallBack func gets called every time this ISR executes.
     if (I2C_Interrupt_Write_Col) {
         I2C_Interrupt_Write_Col();
@@ -13,7 +13,7 @@
 //==================================================
 #include "I2C_cfg.h"
 #include "../GPIO/gpio.h"
-#include "../interrupt/internal_interrupt.h"
+#include "../Interrupt/internal_interrupt.h"
 
 //==================================================
 // Macro Declarations
@@ -58,6 +58,9 @@
 #define I2C_ACK         0  
 #define I2C_NOT_ACK     1
 
+#define I2C_MASTER_IDLE         0
+#define I2C_MASTER_BUSY         1
+
 //==================================================
 // Macro Functions Declarations 
 //==================================================
@@ -141,6 +144,37 @@ typedef enum
     I2C_SLAVE_10BITS_ADD_S_P_ENABLED = 15
 }I2C_mode_select_t;
 
+/**
+ * @brief Progress of a queued master transaction.
+ */
+typedef enum
+{
+    I2C_TRANSACTION_PENDING = 0,    /* Waiting in the queue */
+    I2C_TRANSACTION_BUSY,           /* On the bus */
+    I2C_TRANSACTION_DONE,           /* Completed successfully */
+    I2C_TRANSACTION_NACK,           /* The slave did not acknowledge, stopped early */
+    I2C_TRANSACTION_BUS_COLLISION   /* Lost the bus, aborted */
+}i2c_transaction_status_t;
+
+/**
+ * @brief Master transaction descriptor.
+ * 
+ * Writes write_len bytes then, after a repeated start, reads read_len bytes from
+ * slave_address (7-bit, unshifted). Either length may be zero, with both zero
+ * the slave is only addressed, which is useful for ACK polling.
+ * The descriptor and its buffers belong to the driver until the callback runs.
+ */
+typedef struct i2c_transaction_s
+{
+    uint8 slave_address;
+    const uint8 *write_buf;
+    uint8 write_len;
+    uint8 *read_buf;
+    uint8 read_len;
+    volatile i2c_transaction_status_t status;
+    void (* callback)(struct i2c_transaction_s *transaction);
+}i2c_transaction_t;
+
 typedef struct 
 {
     uint32 i2c_clock_freq;
@@ -308,5 +342,79 @@ Std_ReturnType I2C_Slave_Recieve(uint8 *rec_data);
  */
 Std_ReturnType I2C_Master_Send_1Byte(uint8 slave_address, uint8 data, uint8 *_ack);
 
+/**
+ * @brief Writes a buffer to a slave in master mode via the I2C communication.
+ * 
+ * Sends start, the address with the write bit, len data bytes and stop in one call.
+ * The transfer is cut short with a stop as soon as the slave NACKs a byte.
+ * 
+ * @param slave_address The 7-bit address of the target slave device.
+ * @param data A pointer to the bytes to be transmitted.
+ * @param len Number of bytes to transmit.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: All bytes were acknowledged.
+ *         - E_NOT_OK: Null pointer, or the slave did not acknowledge.
+ */
+Std_ReturnType I2C_Master_WriteBuffer(uint8 slave_address, const uint8 *data, uint8 len);
+
+/**
+ * @brief Reads a buffer from a slave in master mode via the I2C communication.
+ * 
+ * Sends start and the address with the read bit, then clocks in len bytes,
+ * acknowledging every byte but the last one which gets a NACK, then stop.
+ * 
+ * @param slave_address The 7-bit address of the target slave device.
+ * @param data A pointer to store the received bytes.
+ * @param len Number of bytes to receive.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer, zero length, or the slave did not acknowledge its address.
+ */
+Std_ReturnType I2C_Master_ReadBuffer(uint8 slave_address, uint8 *data, uint8 len);
+
+/**
+ * @brief Writes then reads a slave in one transfer via the I2C communication.
+ * 
+ * Typical register access: the register pointer is written, then a repeated start
+ * turns the bus around and rlen bytes are read, the last one with a NACK, then stop.
+ * 
+ * @param slave_address The 7-bit address of the target slave device.
+ * @param wdata A pointer to the bytes to write first (register pointer).
+ * @param wlen Number of bytes to write.
+ * @param rdata A pointer to store the received bytes.
+ * @param rlen Number of bytes to receive.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer, zero read length, or the slave did not acknowledge.
+ */
+Std_ReturnType I2C_Master_WriteRead(uint8 slave_address, const uint8 *wdata, uint8 wlen, uint8 *rdata, uint8 rlen);
+
+#if I2C_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Queues a master transaction to be run from I2C_ISR.
+ * 
+ * The transaction starts right away if the bus is idle, otherwise when the ones
+ * before it have completed. Its status moves to DONE, NACK or BUS_COLLISION
+ * and its callback (if any) is called from the ISR once the stop condition is out.
+ * The MSSP must have been initialized in I2C_MASTER_DEFINED_CLOCK mode.
+ * 
+ * @param transaction A pointer to the transaction descriptor.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The transaction was queued.
+ *         - E_NOT_OK: Null pointer or the queue is full.
+ */
+Std_ReturnType I2C_Master_Queue_Transaction(i2c_transaction_t *transaction);
+
+/**
+ * @brief Checks whether the interrupt-driven master has work in progress.
+ * 
+ * @param busy A pointer to store I2C_MASTER_BUSY or I2C_MASTER_IDLE.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType I2C_Master_Is_Busy(uint8 *busy);
+#endif
+
 #endif	/* I2C_H */
 
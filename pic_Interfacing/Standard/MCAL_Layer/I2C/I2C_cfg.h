@@ -15,6 +15,8 @@
 //==================================================
 // Macro Declarations
 //==================================================
+//Number of transactions the interrupt-driven master can hold in its queue.
+#define I2C_MASTER_QUEUE_SIZE       4U
 
 //==================================================
 // Macro Functions Declarations 
@@ -164,6 +164,21 @@
 #endif
 #endif
 
+#if EEPROM_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+//This macro enables the data EEPROM write operation interrupt.
+#define EEPROM_INTERRUPT_ENABLE()      (PIE2bits.EEIE = 1)
+//This macro disables the data EEPROM write operation interrupt.
+#define EEPROM_INTERRUPT_DISABLE()     (PIE2bits.EEIE = 0)
+//This macro clears the data EEPROM write operation interrupt flag.
+#define EEPROM_INTERRUPT_FLAG_CLEAR()  (PIR2bits.EEIF = 0)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+//This macro sets the data EEPROM interrupt as high priority.
+#define EEPROM_INT_HIGH_PRIORITY()      (IPR2bits.EEIP = 1)
+//This macro sets the data EEPROM interrupt as low priority.
+#define EEPROM_INT_LOW_PRIORITY()       (IPR2bits.EEIP = 0)
+#endif
+#endif
+
 //This macro enables the interrupt for EUSART_TX module.
 #define EUSART_TX_INTERRUPT_ENABLE()      (PIE1bits.TXIE = 1)
 //This macro disables the interrupt for EUSART_TX module.
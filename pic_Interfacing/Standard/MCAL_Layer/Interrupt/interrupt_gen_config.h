@@ -22,7 +22,7 @@
 #define EXTERNAL_INTERRUPT_INTx_ENABLE            INTERRUPT_FEATURE_ENABLE  
 #define EXTERNAL_INTERRUPT_ONCHANGE_ENABLE        INTERRUPT_FEATURE_ENABLE 
 
-//#define ADC_INTERRUPT_ENABLE_FEATURE              INTERRUPT_FEATURE_ENABLE
+#define ADC_INTERRUPT_ENABLE_FEATURE              INTERRUPT_FEATURE_ENABLE
 
 #define TIMER0_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
 #define TIMER1_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
@@ -35,6 +35,40 @@
 #define SPI_INTERRUPT_ENABLE_FEATURE              INTERRUPT_FEATURE_ENABLE
 #define I2C_INTERRUPT_ENABLE_FEATURE              INTERRUPT_FEATURE_ENABLE
 
+#define EEPROM_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
+
+/*
+ * Per source call count, execution time and dispatch delay, timestamped with a
+ * free running Timer1 or Timer3 (1 or 3). The timer is not configured here, run
+ * it without its interrupt and with RD16 set so both count bytes are latched.
+ */
+//#define INTERRUPT_PROFILING_ENABLE                INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_PROFILING_TIMER                 1
+
+/*
+ * Service order of the pending interrupt sources, first listed first served.
+ * Every pending source is still serviced on each entry, the order decides who
+ * waits least. Put the latency critical sources first, sources a project never
+ * enables may be removed to shorten the dispatch table.
+ */
+#define INTERRUPT_DISPATCH_ORDER            \
+    INTERRUPT_SOURCE_INT0,                  \
+    INTERRUPT_SOURCE_INT1,                  \
+    INTERRUPT_SOURCE_INT2,                  \
+    INTERRUPT_SOURCE_RBx,                   \
+    INTERRUPT_SOURCE_ADC,                   \
+    INTERRUPT_SOURCE_TMR0,                  \
+    INTERRUPT_SOURCE_TMR1,                  \
+    INTERRUPT_SOURCE_TMR2,                  \
+    INTERRUPT_SOURCE_TMR3,                  \
+    INTERRUPT_SOURCE_CCP1,                  \
+    INTERRUPT_SOURCE_CCP2,                  \
+    INTERRUPT_SOURCE_EUSART_TX,             \
+    INTERRUPT_SOURCE_EUSART_RX,             \
+    INTERRUPT_SOURCE_MSSP,                  \
+    INTERRUPT_SOURCE_I2C_BUS_COL,           \
+    INTERRUPT_SOURCE_EEPROM
+
 //==================================================
 //                 Macro Functions Declarations 
 //==================================================
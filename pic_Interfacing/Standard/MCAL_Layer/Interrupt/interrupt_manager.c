@@ -9,6 +9,10 @@
 // Includes
 //==================================================
 #include "interrupt_manager.h"
+#if INTERRUPT_PROFILING_ENABLE==INTERRUPT_FEATURE_ENABLE
+#include "../USART/usart.h"
+#include "../../Utilities/Num_Conv/num_conv.h"
+#endif
 
 //==================================================
 // static variables
@@ -43,147 +47,293 @@ void __interrupt(low_priority) InterruptManagerLow(void)
 }
 
 #else
+static const interrupt_source_t interrupt_dispatch_table[] = {
+    INTERRUPT_DISPATCH_ORDER
+};
+
+#define INTERRUPT_DISPATCH_SOURCES  (sizeof(interrupt_dispatch_table) / sizeof(interrupt_dispatch_table[0]))
+
+#if INTERRUPT_PROFILING_ENABLE==INTERRUPT_FEATURE_ENABLE
+/* One row per dispatch table row, then the whole InterruptManager entry */
+#define INTERRUPT_PROFILE_ROWS      (INTERRUPT_DISPATCH_SOURCES + 1U)
+
+static interrupt_profile_t interrupt_profile[INTERRUPT_PROFILE_ROWS];
+
+static inline uint16 Interrupt_Profile_Timestamp(void);
+static void Interrupt_Profile_Record(uint8 index, uint16 start, uint16 end, uint16 entry);
+static Std_ReturnType Interrupt_Profile_Send_Number(uint32 value);
+#endif
+
 void __interrupt() InterruptManager(void)
 {
-    /*_________________________ INTX START _________________________________*/
-    if(INTERRUPT_ENABLE == INTCONbits.INT0IE && INTERRUPT_OCCURR == INTCONbits.INT0IF)
-    {
-        INT0_ISR(); /*EXTERNAL INTERRUPT INT0*/
-    }
-    if(INTERRUPT_ENABLE == INTCON3bits.INT1IE && INTERRUPT_OCCURR == INTCON3bits.INT1IF)
-    {
-        INT1_ISR(); /*EXTERNAL INTERRUPT INT1*/
-    }
-    if(INTERRUPT_ENABLE == INTCON3bits.INT2IE && INTERRUPT_OCCURR == INTCON3bits.INT2IF)
+#if INTERRUPT_PROFILING_ENABLE==INTERRUPT_FEATURE_ENABLE
+    uint16 entry = Interrupt_Profile_Timestamp();
+#endif
+    uint8 pending[INTERRUPT_PENDING_REGS];
+    uint8 intcon = INTCON;
+    uint8 intcon3 = INTCON3;
+
+    /* Each flag sits 3 bits below its enable in INTCON and INTCON3 */
+    pending[INTERRUPT_PENDING_INTCON] = (uint8)(((intcon >> 3) & intcon & 0x07) | (((intcon3 >> 3) & intcon3 & 0x03) << 3));
+    pending[INTERRUPT_PENDING_PIR1] = PIR1 & PIE1;
+    pending[INTERRUPT_PENDING_PIR2] = PIR2 & PIE2;
+
+    for(uint8 index = 0; index < INTERRUPT_DISPATCH_SOURCES; index++)
     {
-        INT2_ISR(); /*EXTERNAL INTERRUPT INT2*/
+        /* Nothing left to service, skip the rest of the table */
+        if(0 == (pending[INTERRUPT_PENDING_INTCON] | pending[INTERRUPT_PENDING_PIR1] | pending[INTERRUPT_PENDING_PIR2]))
+        {
+            break;
+        }
+        const interrupt_source_t *source = &interrupt_dispatch_table[index];
+        if(pending[source->pending_reg] & source->pending_mask)
+        {
+            pending[source->pending_reg] &= (uint8)~source->pending_mask;
+#if INTERRUPT_PROFILING_ENABLE==INTERRUPT_FEATURE_ENABLE
+            uint16 start = Interrupt_Profile_Timestamp();
+            source->handler();
+            Interrupt_Profile_Record(index, start, Interrupt_Profile_Timestamp(), entry);
+#else
+            source->handler();
+#endif
+        }
     }
-    /*_________________________ INTX END _________________________________*/
+#if INTERRUPT_PROFILING_ENABLE==INTERRUPT_FEATURE_ENABLE
+    Interrupt_Profile_Record(INTERRUPT_DISPATCH_SOURCES, entry, Interrupt_Profile_Timestamp(), entry);
+#endif
+}
 
-    /*_________________________ PORTB external on change interrupt start _________________________________*/
-    /*_________________________ RB4 START _________________________________*/
-    if(INTERRUPT_ENABLE == INTCONbits.RBIE && INTERRUPT_OCCURR == INTCONbits.RBIF 
-    && PORTBbits.RB4 == GPIO_HIGH && RB4_Flag == 1)
+/*_________________________ PORTB external on change interrupt _________________________________*/
+void RBx_ISR(void)
+{
+    /* Reading PORTB once ends the mismatch, so every pin that changed is serviced here */
+    uint8 portb = PORTB;
+
+    INTCONbits.RBIF = INTERRUPT_NOT_OCCURR;
+
+    if((portb & 0x10) && RB4_Flag == 1)
     {
-        RB4_Flag = 0; 
+        RB4_Flag = 0;
         RB4_ISR(1);
     }
-    if(INTERRUPT_ENABLE == INTCONbits.RBIE && INTERRUPT_OCCURR == INTCONbits.RBIF 
-    && PORTBbits.RB4 == GPIO_LOW && RB4_Flag == 0)
+    else if(!(portb & 0x10) && RB4_Flag == 0)
     {
-        RB4_Flag = 1;       
+        RB4_Flag = 1;
         RB4_ISR(0);
     }
-    /*_________________________ RB4 END _________________________________*/
-    /*_________________________ RB5 START _________________________________*/
-    if(INTERRUPT_ENABLE == INTCONbits.RBIE && INTERRUPT_OCCURR == INTCONbits.RBIF 
-    && PORTBbits.RB5 == GPIO_HIGH && RB5_Flag == 1)
+
+    if((portb & 0x20) && RB5_Flag == 1)
     {
         RB5_Flag = 0;
         RB5_ISR(1);
     }
-    if(INTERRUPT_ENABLE == INTCONbits.RBIE && INTERRUPT_OCCURR == INTCONbits.RBIF 
-    && PORTBbits.RB5 == GPIO_LOW && RB5_Flag == 0)
+    else if(!(portb & 0x20) && RB5_Flag == 0)
     {
         RB5_Flag = 1;
         RB5_ISR(0);
     }
-    /*_________________________ RB5 END _________________________________*/
-    /*_________________________ RB6 START _________________________________*/
-    if(INTERRUPT_ENABLE == INTCONbits.RBIE && INTERRUPT_OCCURR == INTCONbits.RBIF 
-    && PORTBbits.RB6 == GPIO_HIGH && RB6_Flag == 1)
+
+    if((portb & 0x40) && RB6_Flag == 1)
     {
         RB6_Flag = 0;
         RB6_ISR(1);
     }
-    if(INTERRUPT_ENABLE == INTCONbits.RBIE && INTERRUPT_OCCURR == INTCONbits.RBIF 
-    && PORTBbits.RB6 == GPIO_LOW && RB6_Flag == 0)
+    else if(!(portb & 0x40) && RB6_Flag == 0)
     {
         RB6_Flag = 1;
         RB6_ISR(0);
     }
-    /*_________________________ RB6 END _________________________________*/
-    /*_________________________ RB7 START _________________________________*/
-    if(INTERRUPT_ENABLE == INTCONbits.RBIE && INTERRUPT_OCCURR == INTCONbits.RBIF 
-    && PORTBbits.RB7 == GPIO_HIGH && RB7_Flag == 1)
+
+    if((portb & 0x80) && RB7_Flag == 1)
     {
         RB7_Flag = 0;
         RB7_ISR(1);
     }
-    if(INTERRUPT_ENABLE == INTCONbits.RBIE && INTERRUPT_OCCURR == INTCONbits.RBIF 
-    && PORTBbits.RB7 == GPIO_LOW && RB7_Flag == 0)
+    else if(!(portb & 0x80) && RB7_Flag == 0)
     {
         RB7_Flag = 1;
         RB7_ISR(0);
     }
-    /*_________________________ RB6 END _________________________________*/
-    /*_________________________ PORTB external on change interrupt end _________________________________*/
+}
 
-    if(INTERRUPT_ENABLE == PIE1bits.ADIE && INTERRUPT_OCCURR == PIR1bits.ADIF)
-    {
-        ADC_ISR(); /* ADC INTERRUPT */
-    }
+/**
+ * @brief Takes the current RB4 to RB7 levels as the last ones seen, so the next
+ *        change of each pin is reported in whichever direction it goes. The flags
+ *        start out waiting for a high level, a pin that idles high would otherwise
+ *        drop its first falling edge.
+ */
+void RBx_Level_Sync(void)
+{
+    uint8 Global_Interrupt_Status = INTCONbits.GIE;
+    uint8 portb = ZERO_INIT;
 
-    /*_________________________ TIMER START _________________________________*/
-    if(INTERRUPT_ENABLE == INTCONbits.TMR0IE && INTERRUPT_OCCURR == INTCONbits.TMR0IF)
-    {
-        TIMR0_ISR(); /* TIMER0 INTERRUPT */
-    }
+    INTCONbits.GIE = 0;
+    /* Also ends any mismatch, the levels read here are the ones recorded */
+    portb = PORTB;
+    INTCONbits.RBIF = INTERRUPT_NOT_OCCURR;
+    RB4_Flag = (portb & 0x10) ? 0 : 1;
+    RB5_Flag = (portb & 0x20) ? 0 : 1;
+    RB6_Flag = (portb & 0x40) ? 0 : 1;
+    RB7_Flag = (portb & 0x80) ? 0 : 1;
+    INTCONbits.GIE = Global_Interrupt_Status;
+}
 
-    if(INTERRUPT_ENABLE == PIE1bits.TMR1IE && INTERRUPT_OCCURR == PIR1bits.TMR1IF)
+/*_________________________ MSSP, SPI or I2C by the selected mode _________________________________*/
+void MSSP_ISR(void)
+{
+    if(SSPCON1bits.SSPM <= 5)
     {
-        TIMR1_ISR(); /* TIMER1 INTERRUPT */
+        SPI_ISR(); /* SPI INTERRUPT */
     }
-
-    if(INTERRUPT_ENABLE == PIE1bits.TMR2IE && INTERRUPT_OCCURR == PIR1bits.TMR2IF)
+    else
     {
-        TIMR2_ISR(); /* TIMER2 INTERRUPT */
+        I2C_ISR(); /* I2C INTERRUPT */
     }
+}
+
+#if INTERRUPT_PROFILING_ENABLE==INTERRUPT_FEATURE_ENABLE
+/*_________________________ Profiling _________________________________*/
+/**
+ * @brief Gets the number of profiled rows, the dispatch table rows followed by
+ *        one row for the whole InterruptManager entry.
+ */
+uint8 Interrupt_Profile_Count(void)
+{
+    return (uint8)INTERRUPT_PROFILE_ROWS;
+}
+
+/**
+ * @brief Copies the statistics of one row with interrupts briefly masked.
+ * 
+ * @param index Row, 0 to Interrupt_Profile_Count() - 1.
+ * @param profile A pointer to store the statistics.
+ * @param name A pointer to store the source name, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Interrupt_Profile_Get(uint8 index, interrupt_profile_t *profile, const char **name)
+{
+    Std_ReturnType ret = E_OK;
 
-    if(INTERRUPT_ENABLE == PIE2bits.TMR3IE && INTERRUPT_OCCURR == PIR2bits.TMR3IF)
+    if((NULL == profile) || (index >= INTERRUPT_PROFILE_ROWS))
     {
-        TIMR3_ISR(); /* TIMER3 INTERRUPT */
+        ret = E_NOT_OK;
     }
-    /*_________________________ TIMER END _________________________________*/
-    /*_________________________ CCP START _________________________________*/
-    if(INTERRUPT_ENABLE == PIE1bits.CCP1IE && INTERRUPT_OCCURR == PIR1bits.CCP1IF)
+    else
     {
-        CCP1_ISR(); /* CCP1 INTERRUPT */
-    }
+        uint8 Global_Interrupt_Status = INTCONbits.GIE;
+        INTERRUPT_GlobalInterruptDisable();
+        *profile = interrupt_profile[index];
+        INTCONbits.GIE = Global_Interrupt_Status;
 
-    if(INTERRUPT_ENABLE == PIE2bits.CCP2IE && INTERRUPT_OCCURR == PIR2bits.CCP2IF)
-    {
-        CCP2_ISR(); /* CCP2 INTERRUPT */
+        if(NULL != name)
+        {
+            *name = (index < INTERRUPT_DISPATCH_SOURCES) ? interrupt_dispatch_table[index].name : "ALL";
+        }
     }
-    /*_________________________ CCP END ______________________________________*/
-    /*_________________________ EUSART START _________________________________*/
-    if(INTERRUPT_ENABLE == PIE1bits.TXIE && INTERRUPT_OCCURR == PIR1bits.TXIF)
+    return ret;
+}
+
+/**
+ * @brief Clears the statistics of every row.
+ */
+void Interrupt_Profile_Reset(void)
+{
+    uint8 Global_Interrupt_Status = INTCONbits.GIE;
+    INTERRUPT_GlobalInterruptDisable();
+    for(uint8 index = 0; index < INTERRUPT_PROFILE_ROWS; index++)
     {
-        EUSART_TX_ISR(); /* EUSART TX INTERRUPT */
+        interrupt_profile[index].count = 0;
+        interrupt_profile[index].total_ticks = 0;
+        interrupt_profile[index].min_ticks = 0;
+        interrupt_profile[index].max_ticks = 0;
+        interrupt_profile[index].max_delay_ticks = 0;
     }
+    INTCONbits.GIE = Global_Interrupt_Status;
+}
 
-    if(INTERRUPT_ENABLE == PIE1bits.RCIE && INTERRUPT_OCCURR == PIR1bits.RCIF)
+/**
+ * @brief Prints one line per row that ran at least once over the EUSART:
+ *        name, count, min, avg and max ticks, max delay ticks.
+ *        Blocks until sent, the EUSART must be initialized.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Interrupt_Profile_Dump(void)
+{
+    Std_ReturnType ret = Eusart_Async_SendString_Blocking((uint8 *)"src count min avg max delay\r\n");
+    interrupt_profile_t profile;
+    const char *name;
+
+    /* A row that fails to send is reported in ret, the rows after it are still sent */
+    for(uint8 index = 0; index < INTERRUPT_PROFILE_ROWS; index++)
     {
-        EUSART_RX_ISR(); /* EUSART RX INTERRUPT */
+        if((E_OK == Interrupt_Profile_Get(index, &profile, &name)) && (0 != profile.count))
+        {
+            ret &= Eusart_Async_SendString_Blocking((uint8 *)name);
+            ret &= Eusart_Async_SendByte_Blocking(' ');
+            ret &= Interrupt_Profile_Send_Number(profile.count);
+            ret &= Eusart_Async_SendByte_Blocking(' ');
+            ret &= Interrupt_Profile_Send_Number(profile.min_ticks);
+            ret &= Eusart_Async_SendByte_Blocking(' ');
+            ret &= Interrupt_Profile_Send_Number(profile.total_ticks / profile.count);
+            ret &= Eusart_Async_SendByte_Blocking(' ');
+            ret &= Interrupt_Profile_Send_Number(profile.max_ticks);
+            ret &= Eusart_Async_SendByte_Blocking(' ');
+            ret &= Interrupt_Profile_Send_Number(profile.max_delay_ticks);
+            ret &= Eusart_Async_SendString_Blocking((uint8 *)"\r\n");
+        }
     }
-    /*_________________________ EUSART END _________________________________*/
-    /*_________________________ SPI START _________________________________*/
-    if(INTERRUPT_ENABLE == PIE1bits.SSPIE && INTERRUPT_OCCURR == PIR1bits.SSPIF && SSPCON1bits.SSPM <= 5)
+    return ret;
+}
+
+static inline uint16 Interrupt_Profile_Timestamp(void)
+{
+    /* TMRxL first, with RD16 set that latches TMRxH from the same count */
+#if INTERRUPT_PROFILING_TIMER==3
+    uint8 low = TMR3L;
+    return (uint16)(((uint16)TMR3H << 8) | low);
+#else
+    uint8 low = TMR1L;
+    return (uint16)(((uint16)TMR1H << 8) | low);
+#endif
+}
+
+static void Interrupt_Profile_Record(uint8 index, uint16 start, uint16 end, uint16 entry)
+{
+    interrupt_profile_t *profile = &interrupt_profile[index];
+    /* Unsigned differences stay right across one timer overflow */
+    uint16 ticks = (uint16)(end - start);
+    uint16 delay = (uint16)(start - entry);
+
+    /* A zeroed row has min 0, take its first sample as the minimum */
+    if((0 == profile->count) || (ticks < profile->min_ticks))
     {
-        SPI_ISR(); /* SPI INTERRUPT */
+        profile->min_ticks = ticks;
     }
-    /*_________________________ SPI END _________________________________*/
-    /*_________________________ I2C START _________________________________*/
-    if(INTERRUPT_ENABLE == PIE1bits.SSPIE && INTERRUPT_OCCURR == PIR1bits.SSPIF && SSPCON1bits.SSPM >= 6)
+    if(ticks > profile->max_ticks)
     {
-        I2C_ISR(); /* I2C INTERRUPT */
+        profile->max_ticks = ticks;
     }
-    if(INTERRUPT_ENABLE == PIE2bits.BCLIE && INTERRUPT_OCCURR == PIR2bits.BCLIF)
+    if(delay > profile->max_delay_ticks)
     {
-        I2C_BUS_COL_ISR(); /* I2C BUS COLLISION INTERRUPT */
+        profile->max_delay_ticks = delay;
     }
-    /*_________________________ I2C END _________________________________*/
+    profile->total_ticks += ticks;
+    profile->count++;
+}
+
+static Std_ReturnType Interrupt_Profile_Send_Number(uint32 value)
+{
+    uint8 digits[NUM_CONV_UINT32_SIZE];
 
+    /* The shared converter, no 32-bit division routine gets linked in for this */
+    (void)Num_Conv_Uint32_To_String(value, digits);
+    return Eusart_Async_SendString_Blocking(digits);
 }
+#endif
 
 #endif
\ No newline at end of file
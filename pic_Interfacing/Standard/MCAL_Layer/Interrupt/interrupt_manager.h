@@ -16,6 +16,45 @@
 //==================================================
 // Macro Declarations
 //==================================================
+/* Pending flag snapshots InterruptManager takes once per entry */
+#define INTERRUPT_PENDING_INTCON        0U  /* INTCON and INTCON3 sources, repacked */
+#define INTERRUPT_PENDING_PIR1          1U
+#define INTERRUPT_PENDING_PIR2          2U
+#define INTERRUPT_PENDING_REGS          3U
+
+/* Bits of the repacked INTCON/INTCON3 snapshot */
+#define INTERRUPT_PENDING_RBx           0x01U
+#define INTERRUPT_PENDING_INT0          0x02U
+#define INTERRUPT_PENDING_TMR0          0x04U
+#define INTERRUPT_PENDING_INT1          0x08U
+#define INTERRUPT_PENDING_INT2          0x10U
+
+#if INTERRUPT_PROFILING_ENABLE==INTERRUPT_FEATURE_ENABLE
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+#error "Interrupt profiling instruments the single vector InterruptManager only"
+#endif
+#define INTERRUPT_SOURCE_NAME(name)     , (name)
+#else
+#define INTERRUPT_SOURCE_NAME(name)
+#endif
+
+/* Dispatch table entries, INTERRUPT_DISPATCH_ORDER lists them in service order */
+#define INTERRUPT_SOURCE_INT0           { INTERRUPT_PENDING_INTCON, INTERRUPT_PENDING_INT0, INT0_ISR INTERRUPT_SOURCE_NAME("INT0") }
+#define INTERRUPT_SOURCE_INT1           { INTERRUPT_PENDING_INTCON, INTERRUPT_PENDING_INT1, INT1_ISR INTERRUPT_SOURCE_NAME("INT1") }
+#define INTERRUPT_SOURCE_INT2           { INTERRUPT_PENDING_INTCON, INTERRUPT_PENDING_INT2, INT2_ISR INTERRUPT_SOURCE_NAME("INT2") }
+#define INTERRUPT_SOURCE_RBx            { INTERRUPT_PENDING_INTCON, INTERRUPT_PENDING_RBx,  RBx_ISR INTERRUPT_SOURCE_NAME("RBx") }
+#define INTERRUPT_SOURCE_TMR0           { INTERRUPT_PENDING_INTCON, INTERRUPT_PENDING_TMR0, TIMR0_ISR INTERRUPT_SOURCE_NAME("TMR0") }
+#define INTERRUPT_SOURCE_ADC            { INTERRUPT_PENDING_PIR1,   0x40U,                  ADC_ISR INTERRUPT_SOURCE_NAME("ADC") }
+#define INTERRUPT_SOURCE_EUSART_RX      { INTERRUPT_PENDING_PIR1,   0x20U,                  EUSART_RX_ISR INTERRUPT_SOURCE_NAME("EUSART_RX") }
+#define INTERRUPT_SOURCE_EUSART_TX      { INTERRUPT_PENDING_PIR1,   0x10U,                  EUSART_TX_ISR INTERRUPT_SOURCE_NAME("EUSART_TX") }
+#define INTERRUPT_SOURCE_MSSP           { INTERRUPT_PENDING_PIR1,   0x08U,                  MSSP_ISR INTERRUPT_SOURCE_NAME("MSSP") }
+#define INTERRUPT_SOURCE_CCP1           { INTERRUPT_PENDING_PIR1,   0x04U,                  CCP1_ISR INTERRUPT_SOURCE_NAME("CCP1") }
+#define INTERRUPT_SOURCE_TMR2           { INTERRUPT_PENDING_PIR1,   0x02U,                  TIMR2_ISR INTERRUPT_SOURCE_NAME("TMR2") }
+#define INTERRUPT_SOURCE_TMR1           { INTERRUPT_PENDING_PIR1,   0x01U,                  TIMR1_ISR INTERRUPT_SOURCE_NAME("TMR1") }
+#define INTERRUPT_SOURCE_EEPROM         { INTERRUPT_PENDING_PIR2,   0x10U,                  EEPROM_ISR INTERRUPT_SOURCE_NAME("EEPROM") }
+#define INTERRUPT_SOURCE_I2C_BUS_COL    { INTERRUPT_PENDING_PIR2,   0x08U,                  I2C_BUS_COL_ISR INTERRUPT_SOURCE_NAME("I2C_BUS_COL") }
+#define INTERRUPT_SOURCE_TMR3           { INTERRUPT_PENDING_PIR2,   0x02U,                  TIMR3_ISR INTERRUPT_SOURCE_NAME("TMR3") }
+#define INTERRUPT_SOURCE_CCP2           { INTERRUPT_PENDING_PIR2,   0x01U,                  CCP2_ISR INTERRUPT_SOURCE_NAME("CCP2") }
 
 //==================================================
 // Macro Functions Declarations 
@@ -24,6 +63,33 @@
 //==================================================
 // Data Types Declarations
 //==================================================
+/**
+ * @brief One row of the interrupt dispatch table: the handler runs when
+ *        pending_mask is set in the pending snapshot pending_reg.
+ */
+typedef struct {
+    uint8 pending_reg;
+    uint8 pending_mask;
+    void (*handler)(void);
+#if INTERRUPT_PROFILING_ENABLE==INTERRUPT_FEATURE_ENABLE
+    const char *name;
+#endif
+} interrupt_source_t;
+
+#if INTERRUPT_PROFILING_ENABLE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Timing statistics of one dispatch table row, in profiling timer ticks.
+ *        The delay is measured from InterruptManager entry to the handler call,
+ *        so it is the time spent behind the sources listed before it.
+ */
+typedef struct {
+    uint32 count;
+    uint32 total_ticks;
+    uint16 min_ticks;
+    uint16 max_ticks;
+    uint16 max_delay_ticks;
+} interrupt_profile_t;
+#endif
 
 //==================================================
 // Functions Declarations
@@ -55,5 +121,48 @@ void SPI_ISR(void);
 void I2C_ISR(void);
 void I2C_BUS_COL_ISR(void);
 
+/* Shared vectors, split by InterruptManager into the ISRs above */
+void RBx_ISR(void);
+void RBx_Level_Sync(void);
+void MSSP_ISR(void);
+
+#if INTERRUPT_PROFILING_ENABLE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Gets the number of profiled rows, the dispatch table rows followed by
+ *        one row for the whole InterruptManager entry.
+ */
+uint8 Interrupt_Profile_Count(void);
+
+/**
+ * @brief Copies the statistics of one row with interrupts briefly masked.
+ * 
+ * @param index Row, 0 to Interrupt_Profile_Count() - 1.
+ * @param profile A pointer to store the statistics.
+ * @param name A pointer to store the source name, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Interrupt_Profile_Get(uint8 index, interrupt_profile_t *profile, const char **name);
+
+/**
+ * @brief Clears the statistics of every row.
+ */
+void Interrupt_Profile_Reset(void);
+
+/**
+ * @brief Prints one line per row that ran at least once over the EUSART:
+ *        name, count, min, avg and max ticks, max delay ticks.
+ *        Blocks until sent, the EUSART must be initialized.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Interrupt_Profile_Dump(void);
+#endif
+
+void EEPROM_ISR(void);
+
 #endif	/* INTERRUPT_MANAGER_H */
 
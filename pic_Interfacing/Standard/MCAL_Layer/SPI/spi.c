@@ -15,11 +15,22 @@
 //==================================================
 #if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
 static void (*SPI_InterruptHandler)(void) = NULL;
+static void (*SPI_TransferCompleteHandler)(void) = NULL;
+static volatile uint8 SPI_Async_Busy = 0;
+static const uint8 *SPI_Async_Tx;
+static uint8 *SPI_Async_Rx;
+static uint16 SPI_Async_Remaining;
 #endif
+static const uint8 SPI_Fill_Byte = SPI_TRANSFER_FILL_BYTE;
+static uint8 SPI_Discard_Byte;
+
+/* One full duplex byte, BF is set once the 8th clock has shifted the reply in */
+#define SPI_EXCHANGE(_out, _in)     do{ SSPBUF = (_out); while(!(SSPSTATbits.BF)); (_in) = SSPBUF; }while(0)
 
 static void MSSP_SPI_Interrupt_Init(const SPI_Config *Config);
 static void MSSP_SPI_Msster_Mode_GPIO_PIN_Configurations();
 static void MSSP_SPI_Slave_Mode_GPIO_PIN_Configurations(const SPI_Config *Config);
+static Std_ReturnType SPI_Idle(void);
  
 //==================================================
 // Function definitions
@@ -90,8 +101,9 @@ Std_ReturnType SPI_DeInit(const SPI_Config *Config){
         /* Disable SPI Module */
         SPI_DISABLE_MODULE();
 /* Interrupt Configurations */        
-#if MSSP_SPI_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
-        MSSP_SPI_InterruptDisable();
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+        SPI_INTERRUPT_DISABLE();
+        SPI_Async_Busy = 0;
 #endif
     }
     return ret;
@@ -106,12 +118,12 @@ Std_ReturnType SPI_DeInit(const SPI_Config *Config){
  * @param _data The byte of data to be transmitted.
  * @return Std_ReturnType A status indicating the success or failure of the operation.
  *         - E_OK: The operation was successful.
- *         - E_NOT_OK: An error occurred during transmission.
+ *         - E_NOT_OK: An error occurred during transmission, or a buffer transfer is in progress.
  */
 Std_ReturnType SPI_Master_Send_Receive_Byte(const SPI_Config *Config, const uint8 _dataT, uint8 *_dataR){
-    Std_ReturnType ret = E_NOT_OK;
+    Std_ReturnType ret = E_OK;
     
-    if(NULL == Config){
+    if((NULL == Config) || (NULL == _dataR) || (E_OK != SPI_Idle())){
         ret = E_NOT_OK;
     }
     else{
@@ -132,12 +144,12 @@ Std_ReturnType SPI_Master_Send_Receive_Byte(const SPI_Config *Config, const uint
  * @param _data A pointer to store the received byte.
  * @return Std_ReturnType A status indicating the success or failure of the operation.
  *         - E_OK: The operation was successful.
- *         - E_NOT_OK: An error occurred during reception.
+ *         - E_NOT_OK: An error occurred during reception, or a buffer transfer is in progress.
  */
 Std_ReturnType SPI_Slave_Send_Receive_Byte(const SPI_Config *Config, const uint8 _dataT, uint8 *_dataR){
-    Std_ReturnType ret = E_NOT_OK;
+    Std_ReturnType ret = E_OK;
     
-    if((NULL == Config) || (NULL == _dataR)){
+    if((NULL == Config) || (NULL == _dataR) || (E_OK != SPI_Idle())){
         ret = E_NOT_OK;
     }
     else{
@@ -151,34 +163,176 @@ Std_ReturnType SPI_Slave_Send_Receive_Byte(const SPI_Config *Config, const uint8
 /**
  * @brief Sends a single byte of data via SPI in a non-blocking manner.
  * 
- * This function transmits one byte of data asynchronously, allowing the CPU to perform other tasks while the 
- * SPI transmission completes.
+ * This function loads SSPBUF and returns without waiting. In Master mode that starts the 
+ * exchange, in Slave mode the byte goes out on the next master clocks. The byte shifted in 
+ * meanwhile is picked up with SPI_Read_Byte_NonBlocking(), an unread byte from the previous 
+ * exchange is dropped.
  * 
  * @param Config A pointer to the SPI configuration structure (SPI_Config).
  * @param _data The byte of data to be transmitted.
  * @return Std_ReturnType A status indicating the success or failure of the operation.
  *         - E_OK: The operation was successful.
- *         - E_NOT_OK: An error occurred during transmission.
+ *         - E_NOT_OK: A transfer is in progress, or a write collision occurred.
  */
 Std_ReturnType SPI_Send_Byte_NonBlocking(const SPI_Config *Config, const uint8 _data){
+    Std_ReturnType ret = E_OK;
     
+    if((NULL == Config) || (E_OK != SPI_Idle())){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* A byte left in SSPBUF would hold BF set over the new exchange */
+        if(SSPSTATbits.BF){
+            SPI_Discard_Byte = SSPBUF;
+        }
+        SSPCON1bits.WCOL = SPI_WRITE_COLLISION_NOT_DETECTED;
+        SSPBUF = _data;
+        if(SPI_WRITE_COLLISION_DETECTED == SSPCON1bits.WCOL){
+            /* Still shifting the previous byte, this one was not taken */
+            SSPCON1bits.WCOL = SPI_WRITE_COLLISION_NOT_DETECTED;
+            ret = E_NOT_OK;
+        }
+    }
+    
+    return ret;
 }
 
 /**
  * @brief Receives a single byte of data via SPI in a non-blocking manner.
  * 
- * This function reads one byte of data asynchronously from the SPI module into the provided data pointer.
+ * This function reads the received byte if an exchange has completed, and returns at once otherwise.
  * 
  * @param Config A pointer to the SPI configuration structure (SPI_Config).
  * @param _data A pointer to store the received byte.
  * @return Std_ReturnType A status indicating the success or failure of the operation.
  *         - E_OK: The operation was successful.
- *         - E_NOT_OK: An error occurred during reception.
+ *         - E_NOT_OK: Nothing received yet, or a transfer is in progress.
  */
 Std_ReturnType SPI_Read_Byte_NonBlocking(const SPI_Config *Config, uint8 *_data){
+    Std_ReturnType ret = E_OK;
     
+    if((NULL == Config) || (NULL == _data) || (E_OK != SPI_Idle())){
+        ret = E_NOT_OK;
+    }
+    else if(SPI_BUFFER_FULL_RECEIVE_COMPLETE == SSPSTATbits.BF){
+        *_data = SSPBUF;
+    }
+    else{
+        ret = E_NOT_OK;
+    }
+    
+    return ret;
 }
 
+/**
+ * @brief Exchanges a short buffer in Master mode, waiting for every byte.
+ * 
+ * The loop is unrolled by 4 and polls BF only, at FOSC/4 a byte takes 8 instruction 
+ * cycles so this beats any interrupt driven transfer for a few bytes.
+ * 
+ * @param tx The bytes to send, NULL to send SPI_TRANSFER_FILL_BYTE.
+ * @param rx A buffer for the received bytes, NULL to discard them.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Not in Master mode, or an interrupt driven transfer is in progress.
+ */
+Std_ReturnType SPI_Transfer_Blocking(const uint8 *tx, uint8 *rx, uint8 len){
+    Std_ReturnType ret = E_OK;
+    /* A missing buffer becomes a one byte one that the pointer never leaves */
+    uint8 tx_step = (NULL == tx) ? 0 : 1;
+    uint8 rx_step = (NULL == rx) ? 0 : 1;
+    
+    if((SSPCON1bits.SSPM > SPI_MASTER_FOSC_TMR2) || (E_OK != SPI_Idle())){
+        ret = E_NOT_OK;
+    }
+    else{
+        if(NULL == tx){
+            tx = &SPI_Fill_Byte;
+        }
+        if(NULL == rx){
+            rx = &SPI_Discard_Byte;
+        }
+        if(SSPSTATbits.BF){
+            SPI_Discard_Byte = SSPBUF;
+        }
+        for(; len >= 4; len -= 4){
+            SPI_EXCHANGE(*tx, *rx); tx += tx_step; rx += rx_step;
+            SPI_EXCHANGE(*tx, *rx); tx += tx_step; rx += rx_step;
+            SPI_EXCHANGE(*tx, *rx); tx += tx_step; rx += rx_step;
+            SPI_EXCHANGE(*tx, *rx); tx += tx_step; rx += rx_step;
+        }
+        for(; len; len--){
+            SPI_EXCHANGE(*tx, *rx); tx += tx_step; rx += rx_step;
+        }
+    }
+    
+    return ret;
+}
+
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Starts exchanging a buffer in Master mode and returns without waiting.
+ * 
+ * The first byte is written here, every next one from SPI_ISR once the previous one 
+ * is shifted in. The Config handler is not called for these bytes, the complete 
+ * handler is called from SPI_ISR once the last byte is in and may start the next transfer.
+ * 
+ * @param tx The bytes to send, NULL to send SPI_TRANSFER_FILL_BYTE (RX only).
+ * @param rx A buffer for the received bytes, NULL to discard them (TX only).
+ * @param len Number of bytes, both buffers must stay valid until the handler runs.
+ * @param TransferCompleteHandler Called once the whole buffer is exchanged, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: len is 0, not in Master mode, or a transfer is in progress.
+ */
+Std_ReturnType SPI_Transfer_Async(const uint8 *tx, uint8 *rx, uint16 len, void (*TransferCompleteHandler)(void)){
+    Std_ReturnType ret = E_OK;
+    
+    if((0 == len) || (SSPCON1bits.SSPM > SPI_MASTER_FOSC_TMR2) || SPI_Async_Busy){
+        ret = E_NOT_OK;
+    }
+    else{
+        SPI_Async_Busy = 1;
+        SPI_TransferCompleteHandler = TransferCompleteHandler;
+        SPI_Async_Tx = tx;
+        SPI_Async_Rx = rx;
+        SPI_Async_Remaining = len;
+        
+        if(SSPSTATbits.BF){
+            SPI_Discard_Byte = SSPBUF;
+        }
+        /* Cleared before the first byte so its SSPIF is not lost */
+        SPI_INTERRUPT_FLAG_CLEAR();
+        SPI_INTERRUPT_ENABLE();
+        SSPBUF = (NULL == tx) ? SPI_TRANSFER_FILL_BYTE : *SPI_Async_Tx++;
+    }
+    
+    return ret;
+}
+
+/**
+ * @brief Reports whether an interrupt driven transfer is still in progress.
+ * 
+ * @param busy A pointer to store 1 while a transfer is in progress, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Is_Busy(uint8 *busy){
+    Std_ReturnType ret = E_OK;
+    
+    if(NULL == busy){
+        ret = E_NOT_OK;
+    }
+    else{
+        *busy = SPI_Async_Busy;
+    }
+    
+    return ret;
+}
+#endif
+
 //==================================================
 // Statics definitions
 //==================================================
@@ -238,6 +392,15 @@ static void MSSP_SPI_Slave_Mode_GPIO_PIN_Configurations(const SPI_Config *Config
     }
 }
 
+/* The polled paths must not touch SSPBUF while SPI_ISR streams a buffer */
+static Std_ReturnType SPI_Idle(void){
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    return SPI_Async_Busy ? E_NOT_OK : E_OK;
+#else
+    return E_OK;
+#endif
+}
+
 //==================================================
 // ISR
 //==================================================
@@ -248,7 +411,25 @@ void SPI_ISR(void)
 {
 #if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
     SPI_INTERRUPT_FLAG_CLEAR();
-    if(SPI_InterruptHandler){
+    if(SPI_Async_Busy){
+        /* Reading SSPBUF clears BF, it is read even when the reply is discarded */
+        uint8 data = SSPBUF;
+        
+        if(SPI_Async_Rx){
+            *SPI_Async_Rx++ = data;
+        }
+        if(--SPI_Async_Remaining){
+            SSPBUF = SPI_Async_Tx ? *SPI_Async_Tx++ : SPI_TRANSFER_FILL_BYTE;
+        }
+        else{
+            SPI_Async_Busy = 0;
+            /* CallBack func gets called once the whole buffer is exchanged. */
+            if(SPI_TransferCompleteHandler){
+                SPI_TransferCompleteHandler();
+            }
+        }
+    }
+    else if(SPI_InterruptHandler){
         SPI_InterruptHandler();
     }
 #endif  
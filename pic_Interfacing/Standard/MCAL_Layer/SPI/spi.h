@@ -13,7 +13,7 @@
 //==================================================
 #include "spi_cfg.h"
 #include "../GPIO/gpio.h"
-#include "../interrupt/internal_interrupt.h"
+#include "../Interrupt/internal_interrupt.h"
 
 //==================================================
 // Macro Declarations
@@ -117,7 +117,7 @@ Std_ReturnType SPI_DeInit(const SPI_Config *Config);
  * @param _data The byte of data to be transmitted.
  * @return Std_ReturnType A status indicating the success or failure of the operation.
  *         - E_OK: The operation was successful.
- *         - E_NOT_OK: An error occurred during transmission.
+ *         - E_NOT_OK: An error occurred during transmission, or a buffer transfer is in progress.
  */
 Std_ReturnType SPI_Master_Send_Receive_Byte(const SPI_Config *Config, const uint8 _dataT, uint8 *_dataR);
 
@@ -130,36 +130,82 @@ Std_ReturnType SPI_Master_Send_Receive_Byte(const SPI_Config *Config, const uint
  * @param _data A pointer to store the received byte.
  * @return Std_ReturnType A status indicating the success or failure of the operation.
  *         - E_OK: The operation was successful.
- *         - E_NOT_OK: An error occurred during reception.
+ *         - E_NOT_OK: An error occurred during reception, or a buffer transfer is in progress.
  */
 Std_ReturnType SPI_Slave_Send_Receive_Byte(const SPI_Config *Config, const uint8 _dataT, uint8 *_data);
 
 /**
  * @brief Sends a single byte of data via SPI in a non-blocking manner.
  * 
- * This function transmits one byte of data asynchronously, allowing the CPU to perform other tasks while the 
- * SPI transmission completes.
+ * This function loads SSPBUF and returns without waiting. In Master mode that starts the 
+ * exchange, in Slave mode the byte goes out on the next master clocks. The byte shifted in 
+ * meanwhile is picked up with SPI_Read_Byte_NonBlocking(), an unread byte from the previous 
+ * exchange is dropped.
  * 
  * @param Config A pointer to the SPI configuration structure (SPI_Config).
  * @param _data The byte of data to be transmitted.
  * @return Std_ReturnType A status indicating the success or failure of the operation.
  *         - E_OK: The operation was successful.
- *         - E_NOT_OK: An error occurred during transmission.
+ *         - E_NOT_OK: A transfer is in progress, or a write collision occurred.
  */
 Std_ReturnType SPI_Send_Byte_NonBlocking(const SPI_Config *Config, const uint8 _data);
 
 /**
  * @brief Receives a single byte of data via SPI in a non-blocking manner.
  * 
- * This function reads one byte of data asynchronously from the SPI module into the provided data pointer.
+ * This function reads the received byte if an exchange has completed, and returns at once otherwise.
  * 
  * @param Config A pointer to the SPI configuration structure (SPI_Config).
  * @param _data A pointer to store the received byte.
  * @return Std_ReturnType A status indicating the success or failure of the operation.
  *         - E_OK: The operation was successful.
- *         - E_NOT_OK: An error occurred during reception.
+ *         - E_NOT_OK: Nothing received yet, or a transfer is in progress.
  */
 Std_ReturnType SPI_Read_Byte_NonBlocking(const SPI_Config *Config, uint8 *_data);
 
+/**
+ * @brief Exchanges a short buffer in Master mode, waiting for every byte.
+ * 
+ * The loop is unrolled by 4 and polls BF only, at FOSC/4 a byte takes 8 instruction 
+ * cycles so this beats any interrupt driven transfer for a few bytes.
+ * 
+ * @param tx The bytes to send, NULL to send SPI_TRANSFER_FILL_BYTE.
+ * @param rx A buffer for the received bytes, NULL to discard them.
+ * @param len Number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Not in Master mode, or an interrupt driven transfer is in progress.
+ */
+Std_ReturnType SPI_Transfer_Blocking(const uint8 *tx, uint8 *rx, uint8 len);
+
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Starts exchanging a buffer in Master mode and returns without waiting.
+ * 
+ * The first byte is written here, every next one from SPI_ISR once the previous one 
+ * is shifted in. The Config handler is not called for these bytes, the complete 
+ * handler is called from SPI_ISR once the last byte is in and may start the next transfer.
+ * 
+ * @param tx The bytes to send, NULL to send SPI_TRANSFER_FILL_BYTE (RX only).
+ * @param rx A buffer for the received bytes, NULL to discard them (TX only).
+ * @param len Number of bytes, both buffers must stay valid until the handler runs.
+ * @param TransferCompleteHandler Called once the whole buffer is exchanged, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: len is 0, not in Master mode, or a transfer is in progress.
+ */
+Std_ReturnType SPI_Transfer_Async(const uint8 *tx, uint8 *rx, uint16 len, void (*TransferCompleteHandler)(void));
+
+/**
+ * @brief Reports whether an interrupt driven transfer is still in progress.
+ * 
+ * @param busy A pointer to store 1 while a transfer is in progress, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Is_Busy(uint8 *busy);
+#endif
+
 #endif	/* SPI_H */
 
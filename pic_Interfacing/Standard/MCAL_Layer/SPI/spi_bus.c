@@ -0,0 +1,268 @@
+/* 
+ * File:   spi_bus.c
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+//==================================================
+// Includes
+//==================================================
+#include "spi_bus.h"
+
+//==================================================
+// Statics
+//==================================================
+/* The device whose CS is low, NULL when every CS is high */
+static const spi_bus_device_t *SPI_Bus_Selected = NULL;
+
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+static spi_bus_transaction_t SPI_Bus_Queue[SPI_BUS_QUEUE_SIZE];
+static volatile uint8 SPI_Bus_Head = 0;     /* Written by SPI_Bus_Submit only */
+static volatile uint8 SPI_Bus_Tail = 0;     /* Written by SPI_Bus_Transaction_Done only */
+static volatile uint8 SPI_Bus_Running = 0;
+
+static void SPI_Bus_Start_Next(void);
+static void SPI_Bus_Finish(Std_ReturnType status);
+static void SPI_Bus_Transaction_Done(void);
+#endif
+static void SPI_Bus_Select(const spi_bus_device_t *device);
+static void SPI_Bus_Release(void);
+
+//==================================================
+// Function definitions
+//==================================================
+/**
+ * @brief Initializes the MSSP in Master mode for the bus manager and empties the queue.
+ *
+ * The bus manager owns the MSSP from here on, the plain SPI transfer functions must
+ * not be used next to it.
+ *
+ * @param Config A pointer to the SPI configuration structure (SPI_Config), a Master mode.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or not a Master mode.
+ */
+Std_ReturnType SPI_Bus_Init(const SPI_Config *Config){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == Config) || (Config->spi_mode > SPI_MASTER_FOSC_TMR2)){
+        ret = E_NOT_OK;
+    }
+    else{
+        SPI_Bus_Selected = NULL;
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+        SPI_Bus_Head = 0;
+        SPI_Bus_Tail = 0;
+        SPI_Bus_Running = 0;
+#endif
+        ret = SPI_Init(Config);
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Drives the CS pin of a device high as an output, call it once per device.
+ *
+ * @param device A pointer to the device, must stay valid while the bus uses it.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or a mode that is not a Master mode.
+ */
+Std_ReturnType SPI_Bus_Device_Init(const spi_bus_device_t *device){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == device) || (device->spi_mode > SPI_MASTER_FOSC_TMR2)){
+        ret = E_NOT_OK;
+    }
+    else{
+        pin_config_t cs = device->cs;
+
+        /* LAT first, so the pin never drives low when it turns into an output */
+        cs.direction = GPIO_DIRECTION_OUTPUT;
+        ret = gpio_pin_write(&cs, GPIO_HIGH);
+        ret &= gpio_pin_set_direction(&cs);
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Exchanges a short buffer with a device, waiting for every byte.
+ *
+ * Reconfigures the MSSP only if the device needs other settings than the last one.
+ *
+ * @param device A pointer to the device.
+ * @param tx The bytes to send, NULL to send SPI_TRANSFER_FILL_BYTE.
+ * @param rx A buffer for the received bytes, NULL to discard them.
+ * @param len Number of bytes.
+ * @param cs_action SPI_BUS_CS_RELEASE or SPI_BUS_CS_HOLD.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer, or queued transactions are still running.
+ */
+Std_ReturnType SPI_Bus_Transfer_Blocking(const spi_bus_device_t *device, const uint8 *tx, uint8 *rx,
+                                         uint8 len, uint8 cs_action){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == device){
+        ret = E_NOT_OK;
+    }
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    else if(SPI_Bus_Running || (SPI_Bus_Head != SPI_Bus_Tail)){
+        ret = E_NOT_OK;
+    }
+#endif
+    else{
+        SPI_Bus_Select(device);
+        ret = SPI_Transfer_Blocking(tx, rx, len);
+        if(SPI_BUS_CS_HOLD != cs_action){
+            SPI_Bus_Release();
+        }
+    }
+
+    return ret;
+}
+
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Queues a transaction and returns without waiting.
+ *
+ * Transactions run back to back from SPI_ISR in the order they were submitted. Before
+ * each one the MSSP is reconfigured only if its device needs other settings than the
+ * one before, and the CS of that device goes low. May be called from a complete handler.
+ * A transaction the MSSP refuses to start, e.g. while a plain SPI transfer still runs,
+ * is dropped: its CS goes high and its handler gets E_NOT_OK.
+ *
+ * @param transaction A pointer to the transaction, copied. The buffers must stay valid
+ *        until its handler runs.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid transaction or the queue is full.
+ */
+Std_ReturnType SPI_Bus_Submit(const spi_bus_transaction_t *transaction){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == transaction) || (NULL == transaction->device) || (0 == transaction->len)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* SPI_ISR may finish the running transaction meanwhile and must see either state */
+        uint8 Global_Interrupt_Status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        uint8 head = SPI_Bus_Head;
+
+        if((uint8)(head - SPI_Bus_Tail) >= SPI_BUS_QUEUE_SIZE){
+            ret = E_NOT_OK;
+        }
+        else{
+            SPI_Bus_Queue[head & SPI_BUS_QUEUE_MASK] = *transaction;
+            SPI_Bus_Head = (uint8)(head + 1U);
+            if(0 == SPI_Bus_Running){
+                SPI_Bus_Start_Next();
+            }
+        }
+        INTCONbits.GIE = Global_Interrupt_Status;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Reports whether the queue is empty and no transaction is running.
+ *
+ * @param idle A pointer to store 1 when idle, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Bus_Is_Idle(uint8 *idle){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == idle){
+        ret = E_NOT_OK;
+    }
+    else{
+        *idle = ((0 == SPI_Bus_Running) && (SPI_Bus_Head == SPI_Bus_Tail)) ? 1 : 0;
+    }
+
+    return ret;
+}
+#endif
+
+//==================================================
+// Statics definitions
+//==================================================
+/**
+ * @brief Lowers the CS of a device, first raising the CS of another device that still
+ *        holds it and applying the device settings if they differ from the MSSP ones.
+ */
+static void SPI_Bus_Select(const spi_bus_device_t *device){
+    if(SPI_Bus_Selected != device){
+        SPI_Bus_Release();
+        /* Compared with the registers, a device with the same settings costs no reconfiguration */
+        if((device->spi_mode != SSPCON1bits.SSPM) ||
+           (device->spi_config.ClockPolarity != SSPCON1bits.CKP) ||
+           (device->spi_config.SampleSelect != SSPSTATbits.SMP) ||
+           (device->spi_config.ClockSelect != SSPSTATbits.CKE)){
+            /* With every CS high, so the SCK idle level settles before the next frame */
+            SPI_DISABLE_MODULE();
+            SSPCON1bits.SSPM = device->spi_mode;
+            SSPCON1bits.CKP = device->spi_config.ClockPolarity;
+            SSPSTATbits.SMP = device->spi_config.SampleSelect;
+            SSPSTATbits.CKE = device->spi_config.ClockSelect;
+            SPI_ENABLE_MODULE();
+        }
+        (void)gpio_pin_write(&device->cs, GPIO_LOW);
+        SPI_Bus_Selected = device;
+    }
+}
+
+static void SPI_Bus_Release(void){
+    if(NULL != SPI_Bus_Selected){
+        (void)gpio_pin_write(&SPI_Bus_Selected->cs, GPIO_HIGH);
+        SPI_Bus_Selected = NULL;
+    }
+}
+
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/* Called with interrupts masked, from SPI_Bus_Submit or SPI_ISR */
+static void SPI_Bus_Start_Next(void){
+    while((0 == SPI_Bus_Running) && (SPI_Bus_Head != SPI_Bus_Tail)){
+        const spi_bus_transaction_t *transaction = &SPI_Bus_Queue[SPI_Bus_Tail & SPI_BUS_QUEUE_MASK];
+
+        /* Set first, a handler submitting from SPI_Bus_Finish below only queues */
+        SPI_Bus_Running = 1;
+        SPI_Bus_Select(transaction->device);
+        if(E_OK != SPI_Transfer_Async(transaction->tx, transaction->rx, transaction->len, SPI_Bus_Transaction_Done)){
+            /* Dropped, the CS must not stay low even for SPI_BUS_CS_HOLD */
+            SPI_Bus_Release();
+            SPI_Bus_Finish(E_NOT_OK);
+        }
+    }
+}
+
+/* Retires the transaction at the tail and calls its handler with status */
+static void SPI_Bus_Finish(Std_ReturnType status){
+    uint8 tail = SPI_Bus_Tail;
+    const spi_bus_transaction_t *transaction = &SPI_Bus_Queue[tail & SPI_BUS_QUEUE_MASK];
+    void (*handler)(Std_ReturnType status) = transaction->TransactionCompleteHandler;
+
+    if(SPI_BUS_CS_HOLD != transaction->cs_action){
+        SPI_Bus_Release();
+    }
+    /* The slot is free before the handler runs, so the handler can submit into it */
+    SPI_Bus_Tail = (uint8)(tail + 1U);
+    if(handler){
+        handler(status);
+    }
+    SPI_Bus_Running = 0;
+}
+
+/* SPI_Transfer_Async complete handler, runs in SPI_ISR */
+static void SPI_Bus_Transaction_Done(void){
+    SPI_Bus_Finish(E_OK);
+    SPI_Bus_Start_Next();
+}
+#endif
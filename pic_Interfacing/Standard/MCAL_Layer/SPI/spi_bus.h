@@ -0,0 +1,133 @@
+/* 
+ * File:   spi_bus.h
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef SPI_BUS_H
+#define	SPI_BUS_H
+
+//==================================================
+// Includes
+//==================================================
+#include "spi.h"
+
+//==================================================
+// Macro Declarations
+//==================================================
+#if (SPI_BUS_QUEUE_SIZE == 0U) || ((SPI_BUS_QUEUE_SIZE & (SPI_BUS_QUEUE_SIZE - 1U)) != 0U)
+#error "SPI_BUS_QUEUE_SIZE must be a power of two"
+#endif
+#if SPI_BUS_QUEUE_SIZE > 128U
+#error "SPI_BUS_QUEUE_SIZE must fit the 8-bit queue indexes"
+#endif
+
+#define SPI_BUS_QUEUE_MASK      (SPI_BUS_QUEUE_SIZE - 1U)
+
+/* Chip select after a transaction */
+#define SPI_BUS_CS_RELEASE      0   /* CS goes high once the last byte is in */
+#define SPI_BUS_CS_HOLD         1   /* CS stays low, the next transaction continues the same frame */
+
+//==================================================
+// Macro Functions Declarations
+//==================================================
+
+//==================================================
+// Data Types Declarations
+//==================================================
+/**
+ * @brief A device on the shared bus, its settings are applied before its CS goes low
+ */
+typedef struct{
+    pin_config_t cs;                /* Active low chip select, any free pin */
+    uint8 spi_mode;                 /* SPI_MASTER_FOSC_DIV4 to SPI_MASTER_FOSC_TMR2 */
+    SPI_Control_Config spi_config;  /* Clock polarity, sample and clock edge */
+}spi_bus_device_t;
+
+/**
+ * @brief One CS framed exchange, copied into the queue by SPI_Bus_Submit()
+ */
+typedef struct{
+    const spi_bus_device_t *device;
+    const uint8 *tx;                /* NULL sends SPI_TRANSFER_FILL_BYTE */
+    uint8 *rx;                      /* NULL discards the replies */
+    uint16 len;
+    uint8 cs_action;                /* SPI_BUS_CS_RELEASE or SPI_BUS_CS_HOLD */
+    void (* TransactionCompleteHandler)(Std_ReturnType status);  /* E_NOT_OK if dropped, may be NULL */
+}spi_bus_transaction_t;
+
+//==================================================
+// Functions Declarations
+//==================================================
+/**
+ * @brief Initializes the MSSP in Master mode for the bus manager and empties the queue.
+ *
+ * The bus manager owns the MSSP from here on, the plain SPI transfer functions must
+ * not be used next to it.
+ *
+ * @param Config A pointer to the SPI configuration structure (SPI_Config), a Master mode.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or not a Master mode.
+ */
+Std_ReturnType SPI_Bus_Init(const SPI_Config *Config);
+
+/**
+ * @brief Drives the CS pin of a device high as an output, call it once per device.
+ *
+ * @param device A pointer to the device, must stay valid while the bus uses it.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or a mode that is not a Master mode.
+ */
+Std_ReturnType SPI_Bus_Device_Init(const spi_bus_device_t *device);
+
+/**
+ * @brief Exchanges a short buffer with a device, waiting for every byte.
+ *
+ * Reconfigures the MSSP only if the device needs other settings than the last one.
+ *
+ * @param device A pointer to the device.
+ * @param tx The bytes to send, NULL to send SPI_TRANSFER_FILL_BYTE.
+ * @param rx A buffer for the received bytes, NULL to discard them.
+ * @param len Number of bytes.
+ * @param cs_action SPI_BUS_CS_RELEASE or SPI_BUS_CS_HOLD.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer, or queued transactions are still running.
+ */
+Std_ReturnType SPI_Bus_Transfer_Blocking(const spi_bus_device_t *device, const uint8 *tx, uint8 *rx,
+                                         uint8 len, uint8 cs_action);
+
+#if SPI_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Queues a transaction and returns without waiting.
+ *
+ * Transactions run back to back from SPI_ISR in the order they were submitted. Before
+ * each one the MSSP is reconfigured only if its device needs other settings than the
+ * one before, and the CS of that device goes low. May be called from a complete handler.
+ * A transaction the MSSP refuses to start, e.g. while a plain SPI transfer still runs,
+ * is dropped: its CS goes high and its handler gets E_NOT_OK.
+ *
+ * @param transaction A pointer to the transaction, copied. The buffers must stay valid
+ *        until its handler runs.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Invalid transaction or the queue is full.
+ */
+Std_ReturnType SPI_Bus_Submit(const spi_bus_transaction_t *transaction);
+
+/**
+ * @brief Reports whether the queue is empty and no transaction is running.
+ *
+ * @param idle A pointer to store 1 when idle, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Bus_Is_Idle(uint8 *idle);
+#endif
+
+#endif	/* SPI_BUS_H */
+
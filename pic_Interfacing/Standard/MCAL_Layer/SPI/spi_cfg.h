@@ -15,6 +15,11 @@
 //==================================================
 // Macro Declarations
 //==================================================
+/* Shifted out by the RX only transfers, most slaves ignore SDI while sending */
+#define SPI_TRANSFER_FILL_BYTE      0xFFU
+
+/* Transactions the bus manager can hold, a power of two */
+#define SPI_BUS_QUEUE_SIZE          8U
 
 //==================================================
 // Macro Functions Declarations 
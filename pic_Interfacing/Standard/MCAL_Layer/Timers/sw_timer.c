@@ -0,0 +1,223 @@
+/* 
+ * File:   sw_timer.c
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+//==================================================
+// Includes
+//==================================================
+#include "sw_timer.h"
+
+//==================================================
+// Statics
+//==================================================
+//Running timers sorted by expiry, each delta counts from the timer before it,
+//so only the first one is decremented per tick.
+static sw_timer_t *sw_timer_list = NULL;
+
+//Free-running tick counts, the ISR writes the first and sw_timer_process() the second.
+static volatile uint8 sw_timer_ticks_counted = ZERO_INIT;
+static uint8 sw_timer_ticks_processed = ZERO_INIT;
+
+static void sw_timer_insert(sw_timer_t *timer, uint16 ticks);
+static void sw_timer_remove(sw_timer_t *timer);
+
+//==================================================
+// Function Definitions
+//==================================================
+
+/**
+ * @brief Stops every timer and drops the ticks not processed yet.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType sw_timer_init(void) {
+    while (sw_timer_list) {
+        sw_timer_remove(sw_timer_list);
+    }
+    sw_timer_ticks_processed = sw_timer_ticks_counted;
+    return E_OK;
+}
+
+/**
+ * @brief Starts a timer, or starts it over with the new values if it is running.
+ * 
+ * @param timer A pointer to the timer, must stay valid while it runs.
+ * @param timeout Ticks from now to the first expiry, 1 or more.
+ * @param period Ticks between the next expiries, 0 for a one-shot timer.
+ * @param callback Called from sw_timer_process() on every expiry, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or a timeout of 0.
+ */
+Std_ReturnType sw_timer_start(sw_timer_t *timer, uint16 timeout, uint16 period, void (*callback)(void)) {
+    Std_ReturnType ret = E_OK;
+
+    if ((NULL == timer) || (0 == timeout)) {
+        ret = E_NOT_OK;
+    } else {
+        sw_timer_remove(timer);
+        timer->timeout = timeout;
+        timer->period = period;
+        timer->callback = callback;
+        sw_timer_insert(timer, timeout);
+    }
+    return ret;
+}
+
+/**
+ * @brief Stops a timer, its callback is not called again until it is started.
+ * 
+ * @param timer A pointer to the timer, stopping a timer that is not running is allowed.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer.
+ */
+Std_ReturnType sw_timer_stop(sw_timer_t *timer) {
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == timer) {
+        ret = E_NOT_OK;
+    } else {
+        sw_timer_remove(timer);
+    }
+    return ret;
+}
+
+/**
+ * @brief Starts a timer over from now with the timeout, period and callback
+ *        of its last sw_timer_start(), e.g. to push a timeout back on activity.
+ * 
+ * @param timer A pointer to the timer, running or not.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or the timer was never started.
+ */
+Std_ReturnType sw_timer_restart(sw_timer_t *timer) {
+    Std_ReturnType ret = E_OK;
+
+    if ((NULL == timer) || (0 == timer->timeout)) {
+        ret = E_NOT_OK;
+    } else {
+        sw_timer_remove(timer);
+        sw_timer_insert(timer, timer->timeout);
+    }
+    return ret;
+}
+
+/**
+ * @brief Reports whether a timer is running.
+ * 
+ * @param timer A pointer to the timer.
+ * @param running A pointer to store 1 while the timer runs, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer.
+ */
+Std_ReturnType sw_timer_is_running(const sw_timer_t *timer, uint8 *running) {
+    Std_ReturnType ret = E_OK;
+
+    if ((NULL == timer) || (NULL == running)) {
+        ret = E_NOT_OK;
+    } else {
+        *running = timer->running;
+    }
+    return ret;
+}
+
+/**
+ * @brief Counts one hardware tick, set it as the TIMR0_InterruptHandler of the
+ *        Timer0 configuration. Takes the same few cycles whatever the timers do.
+ */
+void sw_timer_tick(void) {
+    sw_timer_ticks_counted++;
+}
+
+/**
+ * @brief Applies the ticks counted since the last call and runs the callbacks
+ *        of the timers that expired, call it from the main loop at least once
+ *        every 255 ticks.
+ * 
+ * A tick where no timer expires costs one decrement of the first timer in the list.
+ * Callbacks run in main loop context and may start, stop or restart any timer.
+ */
+void sw_timer_process(void) {
+    sw_timer_t *timer = NULL;
+    void (*callback)(void) = NULL;
+
+    //One byte read, the ISR can't tear it
+    while (sw_timer_ticks_processed != sw_timer_ticks_counted) {
+        sw_timer_ticks_processed++;
+        if (sw_timer_list) {
+            sw_timer_list->delta--;
+            //Timers expiring on the same tick have a delta of 0 behind the first
+            while (sw_timer_list && (0 == sw_timer_list->delta)) {
+                timer = sw_timer_list;
+                callback = timer->callback;
+                sw_timer_remove(timer);
+                //Rearmed from its expiry tick, so the period never drifts, before the
+                //callback so the callback can still stop it
+                if (timer->period) {
+                    sw_timer_insert(timer, timer->period);
+                }
+                if (callback) {
+                    callback();
+                }
+            }
+        }
+    }
+}
+
+//==================================================
+// Static Definitions
+//==================================================
+/**
+ * @brief Links a stopped timer into the list ticks from now, after the timers
+ *        expiring on the same tick so those run in the order they were started.
+ * 
+ * @param timer A pointer to the timer.
+ * @param ticks Ticks from now, 1 or more.
+ */
+static void sw_timer_insert(sw_timer_t *timer, uint16 ticks) {
+    sw_timer_t **link = &sw_timer_list;
+
+    while ((NULL != *link) && ((*link)->delta <= ticks)) {
+        ticks -= (*link)->delta;
+        link = &(*link)->next;
+    }
+    if (NULL != *link) {
+        (*link)->delta -= ticks;
+    }
+    timer->delta = ticks;
+    timer->next = *link;
+    timer->running = 1;
+    *link = timer;
+}
+
+/**
+ * @brief Unlinks a timer if it is running, its remaining delta goes to the
+ *        timer after it so that one keeps its expiry tick.
+ * 
+ * @param timer A pointer to the timer.
+ */
+static void sw_timer_remove(sw_timer_t *timer) {
+    sw_timer_t **link = &sw_timer_list;
+
+    if (timer->running) {
+        while ((NULL != *link) && (*link != timer)) {
+            link = &(*link)->next;
+        }
+        if (NULL != *link) {
+            if (timer->next) {
+                timer->next->delta += timer->delta;
+            }
+            *link = timer->next;
+        }
+        timer->next = NULL;
+        timer->running = 0;
+    }
+}
@@ -0,0 +1,126 @@
+/* 
+ * File:   sw_timer.h
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef SW_TIMER_H
+#define	SW_TIMER_H
+
+//==================================================
+// Includes
+//==================================================
+#include "timer0.h"
+
+//==================================================
+// Macro Declarations
+//==================================================
+//Period of one sw_timer_tick() in microseconds, set by the Timer0 preload.
+#define SW_TIMER_TICK_US            1000UL
+
+//==================================================
+// Macro Functions Declarations 
+//==================================================
+//Timer0 preload for one tick in 16-bit timer mode, PRESCALER_DIV is 2 to 256.
+//At 8 MHz a 1 ms tick is 250 counts with the 1:8 prescaler.
+#define SW_TIMER_TIMER0_PRELOAD(PRESCALER_DIV) \
+    ((uint16)(65536UL - (((_XTAL_FREQ / 4000UL) * SW_TIMER_TICK_US) / (1000UL * (PRESCALER_DIV)))))
+
+//Ticks for a time in milliseconds, rounded up. The resolution is one tick: a timer
+//started between ticks can fire its first expiry up to one tick early, the periods
+//after it are exact.
+#define SW_TIMER_MS(MS) \
+    ((uint16)((((uint32)(MS) * 1000UL) + SW_TIMER_TICK_US - 1UL) / SW_TIMER_TICK_US))
+
+//==================================================
+// Data Types Declarations
+//==================================================
+/**
+ * @brief One software timer, owned by the application and linked into the
+ *        active list while it runs. Only the sw_timer_* functions touch the fields.
+ */
+typedef struct sw_timer_s
+{
+    struct sw_timer_s *next;
+    uint16 delta;               // Ticks after the timer before it in the list.
+    uint16 timeout;             // First expiry, also what sw_timer_restart() uses.
+    uint16 period;              // Ticks between expiries after the first, 0 for one-shot.
+    uint8 running;
+    void (* callback)(void);    // Called from sw_timer_process(), may be NULL.
+}sw_timer_t;
+
+//==================================================
+// Functions Declarations
+//==================================================
+/**
+ * @brief Stops every timer and drops the ticks not processed yet.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType sw_timer_init(void);
+
+/**
+ * @brief Starts a timer, or starts it over with the new values if it is running.
+ * 
+ * @param timer A pointer to the timer, must stay valid while it runs.
+ * @param timeout Ticks from now to the first expiry, 1 or more.
+ * @param period Ticks between the next expiries, 0 for a one-shot timer.
+ * @param callback Called from sw_timer_process() on every expiry, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or a timeout of 0.
+ */
+Std_ReturnType sw_timer_start(sw_timer_t *timer, uint16 timeout, uint16 period, void (*callback)(void));
+
+/**
+ * @brief Stops a timer, its callback is not called again until it is started.
+ * 
+ * @param timer A pointer to the timer, stopping a timer that is not running is allowed.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer.
+ */
+Std_ReturnType sw_timer_stop(sw_timer_t *timer);
+
+/**
+ * @brief Starts a timer over from now with the timeout, period and callback
+ *        of its last sw_timer_start(), e.g. to push a timeout back on activity.
+ * 
+ * @param timer A pointer to the timer, running or not.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or the timer was never started.
+ */
+Std_ReturnType sw_timer_restart(sw_timer_t *timer);
+
+/**
+ * @brief Reports whether a timer is running.
+ * 
+ * @param timer A pointer to the timer.
+ * @param running A pointer to store 1 while the timer runs, 0 otherwise.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer.
+ */
+Std_ReturnType sw_timer_is_running(const sw_timer_t *timer, uint8 *running);
+
+/**
+ * @brief Counts one hardware tick, set it as the TIMR0_InterruptHandler of the
+ *        Timer0 configuration. Takes the same few cycles whatever the timers do.
+ */
+void sw_timer_tick(void);
+
+/**
+ * @brief Applies the ticks counted since the last call and runs the callbacks
+ *        of the timers that expired, call it from the main loop at least once
+ *        every 255 ticks.
+ * 
+ * A tick where no timer expires costs one decrement of the first timer in the list.
+ * Callbacks run in main loop context and may start, stop or restart any timer.
+ */
+void sw_timer_process(void);
+
+#endif	/* SW_TIMER_H */
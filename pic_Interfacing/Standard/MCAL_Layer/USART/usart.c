@@ -14,14 +14,28 @@
 // Globals
 //==================================================
 void (*EUSART_TXInterruptHandler)(void) = NULL;
-//Must read the RCREG to clear the flag in ISR.
-void (*EUSART_RXInterruptHandler)(void) = NULL;
+//Called with the received byte after it has been queued in the RX ring.
+void (*EUSART_RXInterruptHandler)(uint8 data) = NULL;
 void (*EUSART_FramingErrorHandler)(void) = NULL;
 
+//==================================================
+// Statics
+//==================================================
+//TX ring buffer, head is only moved by the writer and tail only by the ISR
+static uint8 eusart_tx_buffer[EUSART_TX_BUFFER_SIZE];
+static volatile uint8 eusart_tx_head = ZERO_INIT;
+static volatile uint8 eusart_tx_tail = ZERO_INIT;
+//RX ring buffer, head is only moved by the ISR and tail only by the reader
+static uint8 eusart_rx_buffer[EUSART_RX_BUFFER_SIZE];
+static volatile uint8 eusart_rx_head = ZERO_INIT;
+static volatile uint8 eusart_rx_tail = ZERO_INIT;
+static volatile usart_error_status_cfg_t eusart_rx_errors;
+
 //==================================================
 // Static functions declaration
 //==================================================
-static inline void Eusart_Baudrate_Calc(const usart_t *_usart);
+static inline Std_ReturnType Eusart_Baudrate_Calc(const usart_t *_usart);
+static inline Std_ReturnType Eusart_Brg_Mode(usart_baudrate_gen_t generator, uint8 *divisor, uint16 *brg_max);
 static inline void Eusart_Async_Tx_Init(const usart_t *_usart);
 static inline void Eusart_Async_Rx_Init(const usart_t *_usart);
 static inline void Eusart_Async_Rx_Restart(void);
@@ -56,13 +70,22 @@ Std_ReturnType Eusart_Async_Init(const usart_t *_usart)
         //Init TX, RX pins as input
         TRISCbits.RC6 = 1; 
         TRISCbits.RC7 = 1; 
+        //Empty the ring buffers and clear the error counters
+        eusart_tx_head = eusart_tx_tail = ZERO_INIT;
+        eusart_rx_head = eusart_rx_tail = ZERO_INIT;
+        eusart_rx_errors.err_status = ZERO_INIT;
+        eusart_rx_errors.usart_ferr_count = ZERO_INIT;
+        eusart_rx_errors.usart_oerr_count = ZERO_INIT;
         //Initialize the SPBRGH:SPBRG registers for the appropriate baud rate
-        Eusart_Baudrate_Calc(_usart);
-        //Initialize TX, RX
-        Eusart_Async_Tx_Init(_usart);
-        Eusart_Async_Rx_Init(_usart);
-        //Enable the Serial Port
-        RCSTAbits.SPEN = 1;
+        ret = Eusart_Baudrate_Calc(_usart);
+        if (E_OK == ret)
+        {
+            //Initialize TX, RX
+            Eusart_Async_Tx_Init(_usart);
+            Eusart_Async_Rx_Init(_usart);
+            //Enable the Serial Port
+            RCSTAbits.SPEN = 1;
+        }
     }
     return ret;
 }
@@ -231,84 +254,437 @@ Std_ReturnType Eusart_Async_SendByte_NonBlocking(uint8 data)
     return ret;
 }
 
+/**
+ * @brief Queues a buffer for transmission without waiting for the line.
+ * 
+ * The bytes are copied into the TX ring buffer and shifted out one by one from
+ * EUSART_TX_ISR, the TX callback gets called once the ring runs empty.
+ * The write is all or nothing, nothing is queued if the ring can't hold len bytes.
+ * Needs the TX interrupt enabled in the usart_t configuration.
+ * 
+ * @param buf A pointer to the data to send.
+ * @param len Number of bytes to send.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or not enough free space in the ring.
+ */
+Std_ReturnType Eusart_Async_Write(const uint8 *buf, uint8 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 head = eusart_tx_head;
+    uint8 i = ZERO_INIT;
+
+    if((NULL == buf) || (len > (uint8)(EUSART_TX_BUFFER_SIZE - (uint8)(head - eusart_tx_tail))))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(i = 0; i < len; i++)
+        {
+            eusart_tx_buffer[head & EUSART_TX_BUFFER_MASK] = buf[i];
+            head++;
+        }
+        //Publish the new bytes only once they are all in place
+        eusart_tx_head = head;
+        EUSART_TX_INTERRUPT_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the number of bytes that can be queued by Eusart_Async_Write right now.
+ * 
+ * @param bytes_free A pointer to store the free space of the TX ring buffer.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Async_Tx_BytesFree(uint8 *bytes_free)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == bytes_free)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *bytes_free = (uint8)(EUSART_TX_BUFFER_SIZE - (uint8)(eusart_tx_head - eusart_tx_tail));
+    }
+    return ret;
+}
+
+/**
+ * @brief Copies up to maxlen received bytes out of the RX ring buffer.
+ * 
+ * The ring is filled by EUSART_RX_ISR, so it needs the RX interrupt enabled
+ * in the usart_t configuration. Never waits for data.
+ * 
+ * @param buf A pointer to store the received data.
+ * @param maxlen Size of buf.
+ * @param read_len A pointer to store the number of bytes copied, may be 0.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Async_Read(uint8 *buf, uint8 maxlen, uint8 *read_len)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 tail = eusart_rx_tail;
+    uint8 available = (uint8)(eusart_rx_head - tail);
+    uint8 i = ZERO_INIT;
+
+    if((NULL == buf) || (NULL == read_len))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(available > maxlen)
+        {
+            available = maxlen;
+        }else{/* Nothing */}
+        for(i = 0; i < available; i++)
+        {
+            buf[i] = eusart_rx_buffer[tail & EUSART_RX_BUFFER_MASK];
+            tail++;
+        }
+        //Hand the slots back to the ISR only after copying them out
+        eusart_rx_tail = tail;
+        *read_len = available;
+    }
+    return ret;
+}
+
+/**
+ * @brief Takes one complete line out of the RX ring buffer.
+ * 
+ * A line ends with '\n', a trailing '\r' is dropped and the result is null terminated.
+ * Nothing is consumed until a whole line has arrived, except when the pending data
+ * can't fit in line, then the first maxlen - 1 bytes are returned as a line of their own.
+ * 
+ * @param line A pointer to store the null terminated line.
+ * @param maxlen Size of line including the terminator.
+ * @param line_len A pointer to store the length of the line without the terminator.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A line was copied.
+ *         - E_NOT_OK: No complete line yet or invalid parameters.
+ */
+Std_ReturnType Eusart_Async_ReadLine(uint8 *line, uint8 maxlen, uint8 *line_len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 tail = eusart_rx_tail;
+    uint8 available = (uint8)(eusart_rx_head - tail);
+    uint8 length = ZERO_INIT;
+    uint8 consumed = ZERO_INIT;
+    uint8 i = ZERO_INIT;
+
+    if((NULL == line) || (NULL == line_len) || (maxlen < 2))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Look for the end of line without consuming anything
+        while(length < available)
+        {
+            if('\n' == eusart_rx_buffer[(uint8)(tail + length) & EUSART_RX_BUFFER_MASK])
+            {
+                consumed = (uint8)(length + 1);
+                break;
+            }
+            else if((uint8)(maxlen - 1) == length)
+            {
+                break;
+            }
+            else
+            {
+                length++;
+            }
+        }
+        //No terminator but the caller's buffer or the whole ring is full: flush it as a line
+        if((ZERO_INIT == consumed) && (((uint8)(maxlen - 1) == length) || (EUSART_RX_BUFFER_SIZE == length)))
+        {
+            consumed = length;
+        }else{/* Nothing */}
+
+        if(ZERO_INIT != consumed)
+        {
+            for(i = 0; i < length; i++)
+            {
+                line[i] = eusart_rx_buffer[(uint8)(tail + i) & EUSART_RX_BUFFER_MASK];
+            }
+            if((length > 0) && ('\r' == line[length - 1]))
+            {
+                length--;
+            }else{/* Nothing */}
+            line[length] = '\0';
+            *line_len = length;
+            eusart_rx_tail = (uint8)(tail + consumed);
+            ret = E_OK;
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the number of received bytes waiting in the RX ring buffer.
+ * 
+ * @param bytes_available A pointer to store the number of bytes waiting.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Async_Rx_BytesAvailable(uint8 *bytes_available)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == bytes_available)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *bytes_available = (uint8)(eusart_rx_head - eusart_rx_tail);
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the receive error flags and counters, then clears the flags.
+ * 
+ * @param error_status A pointer to store the error status.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Async_Get_Error_Status(usart_error_status_cfg_t *error_status)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 rx_int_state = PIE1bits.RCIE;
+
+    if(NULL == error_status)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The 16-bit counters are updated from the ISR, copy them atomically
+        EUSART_RX_INTERRUPT_DISABLE();
+        error_status->err_status = eusart_rx_errors.err_status;
+        error_status->usart_ferr_count = eusart_rx_errors.usart_ferr_count;
+        error_status->usart_oerr_count = eusart_rx_errors.usart_oerr_count;
+        eusart_rx_errors.err_status = ZERO_INIT;
+        PIE1bits.RCIE = rx_int_state;
+    }
+    return ret;
+}
+
+/**
+ * @brief Works out the SPBRGH:SPBRG value for a baud rate and the error it leaves.
+ * 
+ * Integer only, the value is rounded to the nearest one instead of truncated, so
+ * no float32 library gets linked. Touches no register, it can check a baud rate
+ * before Eusart_Async_Init uses it.
+ * 
+ * @param baudrate Desired baud rate.
+ * @param generator The baud rate generator mode @ref usart_baudrate_gen_t.
+ * @param brg_value A pointer to store the SPBRGH:SPBRG value, may be NULL.
+ * @param error_bp A pointer to store the actual minus the desired baud rate in
+ *                 0.01 % of the desired one, e.g. 16 is +0.16 %, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Unknown generator, or the baud rate is out of its range.
+ */
+Std_ReturnType Eusart_Baudrate_Compute(uint32 baudrate, usart_baudrate_gen_t generator,
+                                       uint16 *brg_value, sint16 *error_bp)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 divisor = ZERO_INIT;
+    uint16 brg_max = ZERO_INIT;
+
+    ret = Eusart_Brg_Mode(generator, &divisor, &brg_max);
+    if ((E_OK != ret) || (0 == baudrate) || (baudrate > (_XTAL_FREQ / divisor)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //FOSC clocks per generator count, FOSC / bit_clocks = n + 1 rounded to nearest
+        uint32 bit_clocks = (uint32)divisor * baudrate;
+        uint32 counts = (_XTAL_FREQ + (bit_clocks >> 1)) / bit_clocks;
+
+        if (counts > ((uint32)brg_max + 1UL))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            if (NULL != brg_value)
+            {
+                *brg_value = (uint16)(counts - 1UL);
+            }
+            if (NULL != error_bp)
+            {
+                //actual / desired - 1 = (FOSC - generated) / generated
+                uint32 generated = bit_clocks * counts;
+                uint8 faster = (uint8)(_XTAL_FREQ >= generated);
+                uint32 diff = faster ? (_XTAL_FREQ - generated) : (generated - _XTAL_FREQ);
+                sint16 error = ZERO_INIT;
+
+                //Halve both until diff * 10000 fits in 32 bits, the ratio barely moves
+                while (diff > 214748UL)
+                {
+                    diff >>= 1;
+                    generated >>= 1;
+                }
+                error = (sint16)(((diff * 10000UL) + (generated >> 1)) / generated);
+                *error_bp = faster ? error : (sint16)-error;
+            }
+        }
+    }
+    return ret;
+}
+
 //==================================================
 // Static functions definitions
 //==================================================
 /**
  * @brief Calculates and configures the baud rate for EUSART communication.
  * 
-  * This function calculates and configures the appropriate baud rate for EUSART communication
+ * This function calculates and configures the appropriate baud rate for EUSART communication
  * based on the provided configuration settings. It supports both asynchronous and synchronous modes,
  * as well as 8-bit and 16-bit baud rate generators, high and low-speed modes.
+ * With EUSART_CFG_BAUDRATE defined the register value is a preprocessor constant.
  * 
  * @param _usart A pointer to the EUSART configuration structure containing baud rate settings.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The baud rate can't be generated, the registers are left as they are.
+ */
+static inline Std_ReturnType Eusart_Baudrate_Calc(const usart_t *_usart)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 baudrate_reg_bits = ZERO_INIT;
+
+#ifdef EUSART_CFG_BAUDRATE
+    uint8 divisor = ZERO_INIT;
+    uint16 brg_max = ZERO_INIT;
+
+    //The value is a constant, only the generator mode is checked against it
+    baudrate_reg_bits = (uint16)EUSART_BRG_VALUE(EUSART_CFG_BAUDRATE, EUSART_CFG_BRG_DIVISOR);
+    ret = Eusart_Brg_Mode(_usart->baudrate_generator, &divisor, &brg_max);
+    if ((EUSART_CFG_BRG_DIVISOR != divisor) || (baudrate_reg_bits > brg_max))
+    {
+        ret = E_NOT_OK;
+    }
+#else
+    ret = Eusart_Baudrate_Compute(_usart->baudrate, _usart->baudrate_generator, &baudrate_reg_bits, NULL);
+#endif
+    if (E_OK == ret)
+    {
+        if(EUSART_ASYNC_8BITS_HIGH_SPEED_BAUDRATE == _usart->baudrate_generator)
+        {
+            //Asynchronous mode
+            TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
+            //8-bit Baud Rate Generator    
+            BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
+            //High Speed
+            TXSTAbits.BRGH = EUSART_ASYNC_HIGH_SPEED_CFG; 
+        }
+        else if (EUSART_ASYNC_8BITS_LOW_SPEED_BAUDRATE == _usart->baudrate_generator)
+        {
+            //Asynchronous mode
+            TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
+            //8-bit Baud Rate Generator 
+            BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
+            //Low Speed
+            TXSTAbits.BRGH = EUSART_ASYNC_LOW_SPEED_CFG;
+        }
+        else if (EUSART_ASYNC_16BITS_HIGH_SPEED_BAUDRATE == _usart->baudrate_generator)
+        {
+            //Asynchronous mode
+            TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
+            //16-bit Baud Rate Generator 
+            BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
+            //High Speed
+            TXSTAbits.BRGH = EUSART_ASYNC_HIGH_SPEED_CFG;
+        } 
+        else if (EUSART_ASYNC_16BITS_LOW_SPEED_BAUDRATE == _usart->baudrate_generator)
+        {
+            //Asynchronous mode
+            TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
+            //16-bit Baud Rate Generator 
+            BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
+            //Low Speed
+            TXSTAbits.BRGH = EUSART_ASYNC_LOW_SPEED_CFG;
+        }    
+        else if (EUSART_SYNC_8BITS_BAUDRATE == _usart->baudrate_generator)
+        {
+            //Synchronous mode
+            TXSTAbits.SYNC = EUSART_SYNC_MODE_CFG;
+            //8-bit Baud Rate Generator 
+            BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
+        }
+        else if (EUSART_SYNC_16BITS_BAUDRATE == _usart->baudrate_generator)
+        {
+            //Synchronous mode
+            TXSTAbits.SYNC = EUSART_SYNC_MODE_CFG;
+            //16-bit Baud Rate Generator 
+            BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
+        }
+        SPBRG = (uint8)(baudrate_reg_bits);
+        SPBRGH = (uint8)(baudrate_reg_bits >> 8);
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the clock divisor and the largest SPBRGH:SPBRG value of a generator mode.
+ * 
+ * @param generator The baud rate generator mode @ref usart_baudrate_gen_t.
+ * @param divisor A pointer to store the divisor.
+ * @param brg_max A pointer to store 255 for an 8-bit generator, 65535 for a 16-bit one.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Unknown generator mode.
  */
-static inline void Eusart_Baudrate_Calc(const usart_t *_usart)
+static inline Std_ReturnType Eusart_Brg_Mode(usart_baudrate_gen_t generator, uint8 *divisor, uint16 *brg_max)
 {
-    float32 baudrate_reg_bits = ZERO_INIT;
-
-    if(EUSART_ASYNC_8BITS_HIGH_SPEED_BAUDRATE == _usart->baudrate_generator)
-    {
-        //Asynchronous mode
-        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
-        //8-bit Baud Rate Generator    
-        BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
-        //High Speed
-        TXSTAbits.BRGH = EUSART_ASYNC_HIGH_SPEED_CFG; 
-
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(16*_usart->baudrate)) - 1;
-    }
-    else if (EUSART_ASYNC_8BITS_LOW_SPEED_BAUDRATE == _usart->baudrate_generator)
-    {
-        //Asynchronous mode
-        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
-        //8-bit Baud Rate Generator 
-        BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
-        //Low Speed
-        TXSTAbits.BRGH = EUSART_ASYNC_LOW_SPEED_CFG;
-
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(64*_usart->baudrate)) - 1;
-    }
-    else if (EUSART_ASYNC_16BITS_HIGH_SPEED_BAUDRATE == _usart->baudrate_generator)
-    {
-        //Asynchronous mode
-        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
-        //16-bit Baud Rate Generator 
-        BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
-        //High Speed
-        TXSTAbits.BRGH = EUSART_ASYNC_HIGH_SPEED_CFG;
-
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(4*_usart->baudrate)) - 1;
-    } 
-    else if (EUSART_ASYNC_16BITS_LOW_SPEED_BAUDRATE == _usart->baudrate_generator)
-    {
-        //Asynchronous mode
-        TXSTAbits.SYNC = EUSART_ASYNC_MODE_CFG;
-        //16-bit Baud Rate Generator 
-        BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
-        //Low Speed
-        TXSTAbits.BRGH = EUSART_ASYNC_LOW_SPEED_CFG;
-
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(16*_usart->baudrate)) - 1;
-    }    
-    else if (EUSART_SYNC_8BITS_BAUDRATE == _usart->baudrate_generator)
-    {
-        //Synchronous mode
-        TXSTAbits.SYNC = EUSART_SYNC_MODE_CFG;
-        //8-bit Baud Rate Generator 
-        BAUDCONbits.BRG16 = EUSART_8BITS_BAUD_RATE_CFG;
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(4*_usart->baudrate)) - 1;
-    }
-    else if (EUSART_SYNC_16BITS_BAUDRATE == _usart->baudrate_generator)
-    {
-        //Synchronous mode
-        TXSTAbits.SYNC = EUSART_SYNC_MODE_CFG;
-        //16-bit Baud Rate Generator 
-        BAUDCONbits.BRG16 = EUSART_16BITS_BAUD_RATE_CFG;
-        baudrate_reg_bits = (_XTAL_FREQ/(float32)(4*_usart->baudrate)) - 1;
-    }
-    SPBRG = (uint8)(baudrate_reg_bits);
-    SPBRGH = (uint8)((uint32)baudrate_reg_bits >> 8);
+    Std_ReturnType ret = E_OK;
+
+    switch(generator)
+    {
+        case EUSART_ASYNC_8BITS_LOW_SPEED_BAUDRATE:
+            *divisor = (uint8)EUSART_BRG_DIVISOR_64;
+            *brg_max = 0xFFU;
+            break;
+        case EUSART_ASYNC_8BITS_HIGH_SPEED_BAUDRATE:
+            *divisor = (uint8)EUSART_BRG_DIVISOR_16;
+            *brg_max = 0xFFU;
+            break;
+        case EUSART_ASYNC_16BITS_LOW_SPEED_BAUDRATE:
+            *divisor = (uint8)EUSART_BRG_DIVISOR_16;
+            *brg_max = 0xFFFFU;
+            break;
+        case EUSART_ASYNC_16BITS_HIGH_SPEED_BAUDRATE:
+            *divisor = (uint8)EUSART_BRG_DIVISOR_4;
+            *brg_max = 0xFFFFU;
+            break;
+        case EUSART_SYNC_8BITS_BAUDRATE:
+            *divisor = (uint8)EUSART_BRG_DIVISOR_4;
+            *brg_max = 0xFFU;
+            break;
+        case EUSART_SYNC_16BITS_BAUDRATE:
+            *divisor = (uint8)EUSART_BRG_DIVISOR_4;
+            *brg_max = 0xFFFFU;
+            break;
+        default:
+            ret = E_NOT_OK;
+            break;
+    }
+    return ret;
 }
 
 /**
@@ -417,12 +793,23 @@ static inline void Eusart_Async_Rx_Restart(void)
  */
 void EUSART_TX_ISR(void)
 {
-    EUSART_TX_INTERRUPT_DISABLE();
-    //CallBack func gets called every time this ISR executes.
-    if(EUSART_TXInterruptHandler)
+    uint8 tail = eusart_tx_tail;
+
+    if(tail != eusart_tx_head)
     {
-        EUSART_TXInterruptHandler();
-    }else{/* Nothing */}
+        //TXREG is empty, feed it the next queued byte and keep the interrupt on
+        TXREG = eusart_tx_buffer[tail & EUSART_TX_BUFFER_MASK];
+        eusart_tx_tail = (uint8)(tail + 1);
+    }
+    else
+    {
+        EUSART_TX_INTERRUPT_DISABLE();
+        //CallBack func gets called once there is nothing left to send.
+        if(EUSART_TXInterruptHandler)
+        {
+            EUSART_TXInterruptHandler();
+        }else{/* Nothing */}
+    }
 }
 
 /**
@@ -431,13 +818,42 @@ void EUSART_TX_ISR(void)
  */
 void EUSART_RX_ISR(void)
 {
-    //CallBack func gets called every time this ISR executes.
-    if(EUSART_RXInterruptHandler)
+    uint8 head = eusart_rx_head;
+    //FERR belongs to the byte on top of the FIFO, it must be read before RCREG
+    uint8 framing_error = RCSTAbits.FERR;
+    uint8 data = RCREG;
+
+    if(EUSART_OVERRUN_ER_DETECTED_CFG == RCSTAbits.OERR)
     {
-        EUSART_RXInterruptHandler();
+        eusart_rx_errors.usart_oerr = EUSART_OVERRUN_ER_DETECTED_CFG;
+        eusart_rx_errors.usart_oerr_count++;
+        Eusart_Async_Rx_Restart();
     }else{/* Nothing */}
-    if(EUSART_FramingErrorHandler)
+
+    if(EUSART_FRAMING_ER_DETECTED_CFG == framing_error)
     {
-        EUSART_FramingErrorHandler();
-    }else{/* Nothing */}
+        //Drop the corrupted byte
+        eusart_rx_errors.usart_ferr = EUSART_FRAMING_ER_DETECTED_CFG;
+        eusart_rx_errors.usart_ferr_count++;
+        if(EUSART_FramingErrorHandler)
+        {
+            EUSART_FramingErrorHandler();
+        }else{/* Nothing */}
+    }
+    else if(EUSART_RX_BUFFER_SIZE == (uint8)(head - eusart_rx_tail))
+    {
+        //Ring full, the reader is too slow
+        eusart_rx_errors.usart_oerr = EUSART_OVERRUN_ER_DETECTED_CFG;
+        eusart_rx_errors.usart_oerr_count++;
+    }
+    else
+    {
+        eusart_rx_buffer[head & EUSART_RX_BUFFER_MASK] = data;
+        eusart_rx_head = (uint8)(head + 1);
+        //CallBack func gets called for every byte queued, RCREG is already read.
+        if(EUSART_RXInterruptHandler)
+        {
+            EUSART_RXInterruptHandler(data);
+        }else{/* Nothing */}
+    }
 }
\ No newline at end of file
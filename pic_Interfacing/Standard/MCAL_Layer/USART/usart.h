@@ -13,7 +13,7 @@
 //==================================================
 #include "usart_cfg.h"
 #include "../GPIO/gpio.h"
-#include "../interrupt/internal_interrupt.h"
+#include "../Interrupt/internal_interrupt.h"
 
 //==================================================
 // Macro Declarations
@@ -55,9 +55,40 @@
 #define EUSART_OVERRUN_ER_DETECTED_CFG    1
 #define EUSART_OVERRUN_ER_CLEAR_CFG       0
 
+//TX ring buffer index mask (EUSART_TX_BUFFER_SIZE is a power of two)
+#define EUSART_TX_BUFFER_MASK    (EUSART_TX_BUFFER_SIZE - 1U)
+//RX ring buffer index mask (EUSART_RX_BUFFER_SIZE is a power of two)
+#define EUSART_RX_BUFFER_MASK    (EUSART_RX_BUFFER_SIZE - 1U)
+
+//Baud Rate Generator clock divisor, FOSC / (divisor * (n + 1)) is the baud rate
+#define EUSART_BRG_DIVISOR_64    64UL    /* Async 8-bit low speed */
+#define EUSART_BRG_DIVISOR_16    16UL    /* Async 8-bit high speed, async 16-bit low speed */
+#define EUSART_BRG_DIVISOR_4     4UL     /* Async 16-bit high speed, sync 8-bit and 16-bit */
+
 //==================================================
 // Macro Functions Declarations 
 //==================================================
+/**
+ * @brief SPBRGH:SPBRG value for BAUD, rounded to the nearest register value.
+ *        Plain integer arithmetic, so it also works in #if with constant arguments.
+ */
+#define EUSART_BRG_VALUE(BAUD, DIVISOR) \
+    (((_XTAL_FREQ + (((DIVISOR) * (BAUD)) / 2UL)) / ((DIVISOR) * (BAUD))) - 1UL)
+
+//Baud rate actually produced by a SPBRGH:SPBRG value, truncated to a whole baud
+#define EUSART_BRG_ACTUAL(BRG, DIVISOR)  (_XTAL_FREQ / ((DIVISOR) * ((BRG) + 1UL)))
+
+#ifdef EUSART_CFG_BAUDRATE
+#if (EUSART_BRG_VALUE(EUSART_CFG_BAUDRATE, EUSART_CFG_BRG_DIVISOR) > 65535UL)
+#error "EUSART_CFG_BAUDRATE can't be generated from _XTAL_FREQ with EUSART_CFG_BRG_DIVISOR"
+#endif
+#if ((EUSART_BRG_ACTUAL(EUSART_BRG_VALUE(EUSART_CFG_BAUDRATE, EUSART_CFG_BRG_DIVISOR), EUSART_CFG_BRG_DIVISOR) * 10000UL) > \
+        (EUSART_CFG_BAUDRATE * (10000UL + EUSART_CFG_MAX_ERROR_BP))) || \
+    ((EUSART_BRG_ACTUAL(EUSART_BRG_VALUE(EUSART_CFG_BAUDRATE, EUSART_CFG_BRG_DIVISOR), EUSART_CFG_BRG_DIVISOR) * 10000UL) < \
+        (EUSART_CFG_BAUDRATE * (10000UL - EUSART_CFG_MAX_ERROR_BP)))
+#error "EUSART_CFG_BAUDRATE error is above EUSART_CFG_MAX_ERROR_BP"
+#endif
+#endif
 
 //==================================================
 // Data Types Declarations
@@ -103,6 +134,10 @@ typedef struct
 
 /**
  * @brief Errors Status
+ * 
+ * The flags are set by EUSART_RX_ISR and cleared when read through
+ * Eusart_Async_Get_Error_Status, the counters keep accumulating until the next Init.
+ * Overrun counts both hardware OERR events and bytes dropped on a full RX ring.
  */
 typedef union 
 {
@@ -111,6 +146,8 @@ typedef union
         uint8 usart_ferr : 1;
         uint8 usart_oerr : 1;
         uint8 usart_err_reserved : 6;
+        uint16 usart_ferr_count;
+        uint16 usart_oerr_count;
     };
     uint8 err_status;
 }usart_error_status_cfg_t;
@@ -123,7 +160,7 @@ typedef struct
     usart_rx_cfg_t rx_cfg;                      // @ref usart_rx_cfg_t
     usart_error_status_cfg_t error_status;      // @ref usart_error_status_cfg_t
     void (* EUSART_TXInterruptHandler)(void);
-    void (* EUSART_RXInterruptHandler)(void);
+    void (* EUSART_RXInterruptHandler)(uint8 data);     // Gets the byte, RCREG is already read
     void (* EUSART_FramingErrorHandler)(void);
 }usart_t;
 
@@ -205,5 +242,101 @@ Std_ReturnType Eusart_Async_Receive_NonBlocking(uint8 *data);
  */
 Std_ReturnType Eusart_Async_SendByte_NonBlocking(uint8 data);
 
+/**
+ * @brief Queues a buffer for transmission without waiting for the line.
+ * 
+ * The bytes are copied into the TX ring buffer and shifted out one by one from
+ * EUSART_TX_ISR, the TX callback gets called once the ring runs empty.
+ * The write is all or nothing, nothing is queued if the ring can't hold len bytes.
+ * Needs the TX interrupt enabled in the usart_t configuration.
+ * 
+ * @param buf A pointer to the data to send.
+ * @param len Number of bytes to send.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Null pointer or not enough free space in the ring.
+ */
+Std_ReturnType Eusart_Async_Write(const uint8 *buf, uint8 len);
+
+/**
+ * @brief Gets the number of bytes that can be queued by Eusart_Async_Write right now.
+ * 
+ * @param bytes_free A pointer to store the free space of the TX ring buffer.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Async_Tx_BytesFree(uint8 *bytes_free);
+
+/**
+ * @brief Copies up to maxlen received bytes out of the RX ring buffer.
+ * 
+ * The ring is filled by EUSART_RX_ISR, so it needs the RX interrupt enabled
+ * in the usart_t configuration. Never waits for data.
+ * 
+ * @param buf A pointer to store the received data.
+ * @param maxlen Size of buf.
+ * @param read_len A pointer to store the number of bytes copied, may be 0.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Async_Read(uint8 *buf, uint8 maxlen, uint8 *read_len);
+
+/**
+ * @brief Takes one complete line out of the RX ring buffer.
+ * 
+ * A line ends with '\n', a trailing '\r' is dropped and the result is null terminated.
+ * Nothing is consumed until a whole line has arrived, except when the pending data
+ * can't fit in line, then the first maxlen - 1 bytes are returned as a line of their own.
+ * 
+ * @param line A pointer to store the null terminated line.
+ * @param maxlen Size of line including the terminator.
+ * @param line_len A pointer to store the length of the line without the terminator.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A line was copied.
+ *         - E_NOT_OK: No complete line yet or invalid parameters.
+ */
+Std_ReturnType Eusart_Async_ReadLine(uint8 *line, uint8 maxlen, uint8 *line_len);
+
+/**
+ * @brief Gets the number of received bytes waiting in the RX ring buffer.
+ * 
+ * @param bytes_available A pointer to store the number of bytes waiting.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Async_Rx_BytesAvailable(uint8 *bytes_available);
+
+/**
+ * @brief Gets the receive error flags and counters, then clears the flags.
+ * 
+ * @param error_status A pointer to store the error status.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Eusart_Async_Get_Error_Status(usart_error_status_cfg_t *error_status);
+
+/**
+ * @brief Works out the SPBRGH:SPBRG value for a baud rate and the error it leaves.
+ * 
+ * Integer only, the value is rounded to the nearest one instead of truncated, so
+ * no float32 library gets linked. Touches no register, it can check a baud rate
+ * before Eusart_Async_Init uses it.
+ * 
+ * @param baudrate Desired baud rate.
+ * @param generator The baud rate generator mode @ref usart_baudrate_gen_t.
+ * @param brg_value A pointer to store the SPBRGH:SPBRG value, may be NULL.
+ * @param error_bp A pointer to store the actual minus the desired baud rate in
+ *                 0.01 % of the desired one, e.g. 16 is +0.16 %, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Unknown generator, or the baud rate is out of its range.
+ */
+Std_ReturnType Eusart_Baudrate_Compute(uint32 baudrate, usart_baudrate_gen_t generator,
+                                       uint16 *brg_value, sint16 *error_bp);
+
 #endif	/* USART_H */
 
@@ -15,6 +15,30 @@
 //==================================================
 // Macro Declarations
 //==================================================
+//Size of the TX ring buffer drained by EUSART_TX_ISR (power of two, 2..128)
+#define EUSART_TX_BUFFER_SIZE       64U
+
+#if (EUSART_TX_BUFFER_SIZE < 2U) || (EUSART_TX_BUFFER_SIZE > 128U) || \
+    ((EUSART_TX_BUFFER_SIZE & (EUSART_TX_BUFFER_SIZE - 1U)) != 0U)
+#error "EUSART_TX_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+
+//Size of the RX ring buffer fed by EUSART_RX_ISR (power of two, 2..128)
+#define EUSART_RX_BUFFER_SIZE       64U
+
+#if (EUSART_RX_BUFFER_SIZE < 2U) || (EUSART_RX_BUFFER_SIZE > 128U) || \
+    ((EUSART_RX_BUFFER_SIZE & (EUSART_RX_BUFFER_SIZE - 1U)) != 0U)
+#error "EUSART_RX_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+
+//Compile-time baud rate, uncomment both to have Eusart_Async_Init load SPBRGH:SPBRG with
+//a constant worked out by the preprocessor, usart_t.baudrate is then ignored and the
+//usart_t.baudrate_generator must be one that uses EUSART_CFG_BRG_DIVISOR (see usart.h)
+//#define EUSART_CFG_BAUDRATE          9600UL
+//#define EUSART_CFG_BRG_DIVISOR       EUSART_BRG_DIVISOR_16
+
+//Largest baud rate error the compile-time baud rate accepts, in 0.01 % steps
+#define EUSART_CFG_MAX_ERROR_BP      200UL
 
 //==================================================
 // Macro Functions Declarations 
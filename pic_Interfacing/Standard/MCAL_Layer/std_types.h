@@ -44,10 +44,19 @@
 typedef unsigned char boolean;
 typedef unsigned char uint8;
 typedef unsigned short uint16;
+#ifdef PIC18_SIM_HOST
+/* long is 64 bits on the host, these keep the 32-bit wraparound of XC8 */
+typedef uint32_t uint32;
+#else
 typedef unsigned long uint32;
+#endif
 typedef signed char sint8;
 typedef signed short sint16;
+#ifdef PIC18_SIM_HOST
+typedef int32_t sint32;
+#else
 typedef signed long sint32;
+#endif
 typedef float float32;
 
 typedef uint8 Std_ReturnType;
@@ -0,0 +1,259 @@
+/* 
+ * File:   num_conv.c
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+//==================================================
+// Includes
+//==================================================
+#include "num_conv.h"
+
+//==================================================
+// statics
+//==================================================
+/* 10^4 is the last 32-bit step, everything it leaves fits 16 bits */
+static const uint32 num_conv_pow10_32[] = {
+    1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL, 10000UL
+};
+/* 10^2 is the last 16-bit step, everything it leaves fits 8 bits */
+static const uint16 num_conv_pow10_16[] = {
+    1000U, 100U
+};
+
+#define NUM_CONV_POW10_32_COUNT     (sizeof(num_conv_pow10_32) / sizeof(num_conv_pow10_32[0]))
+#define NUM_CONV_POW10_16_COUNT     (sizeof(num_conv_pow10_16) / sizeof(num_conv_pow10_16[0]))
+/* Where a value that fits 16 bits starts in num_conv_pow10_32, at 10^4 */
+#define NUM_CONV_POW10_32_SHORT     (NUM_CONV_POW10_32_COUNT - 1U)
+
+static uint8 Num_Conv_Digits(uint32 value, uint8 *digits);
+static void Num_Conv_Format(uint8 *str, const uint8 *digits, uint8 count, uint8 negative,
+                            uint8 decimals, uint8 width, uint8 pad);
+
+//==================================================
+// Functions Definitions
+//==================================================
+
+/**
+ * @brief Converts an 8-bit value to a decimal string without leading zeros.
+ *
+ * @param value The value to convert.
+ * @param str A pointer to a buffer of at least NUM_CONV_UINT8_SIZE bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: str is NULL.
+ */
+Std_ReturnType Num_Conv_Uint8_To_String(uint8 value, uint8 *str) {
+    Std_ReturnType ret = E_OK;
+    uint8 hundreds = 0;
+    uint8 tens = 0;
+
+    if (NULL == str) {
+        ret = E_NOT_OK;
+    } else {
+        //At most 2 + 9 single byte subtractions, no division
+        while (value >= 100U) {
+            value -= 100U;
+            hundreds++;
+        }
+        while (value >= 10U) {
+            value -= 10U;
+            tens++;
+        }
+        if (hundreds) {
+            *str++ = (uint8) ('0' + hundreds);
+            *str++ = (uint8) ('0' + tens);
+        } else if (tens) {
+            *str++ = (uint8) ('0' + tens);
+        }
+        *str++ = (uint8) ('0' + value);
+        *str = '\0';
+    }
+    return ret;
+}
+
+/**
+ * @brief Converts a 16-bit value to a decimal string without leading zeros.
+ *
+ * @param value The value to convert.
+ * @param str A pointer to a buffer of at least NUM_CONV_UINT16_SIZE bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: str is NULL.
+ */
+Std_ReturnType Num_Conv_Uint16_To_String(uint16 value, uint8 *str) {
+    return Num_Conv_Uint32_To_String_Width(value, str, 0, NUM_CONV_PAD_SPACE);
+}
+
+/**
+ * @brief Converts a 32-bit value to a decimal string without leading zeros.
+ *
+ * @param value The value to convert.
+ * @param str A pointer to a buffer of at least NUM_CONV_UINT32_SIZE bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: str is NULL.
+ */
+Std_ReturnType Num_Conv_Uint32_To_String(uint32 value, uint8 *str) {
+    return Num_Conv_Uint32_To_String_Width(value, str, 0, NUM_CONV_PAD_SPACE);
+}
+
+/**
+ * @brief Converts a 32-bit value to a decimal string right aligned in a fixed width,
+ *        so a reading rewritten in place on the LCD leaves no stale digits behind.
+ *
+ * A value wider than width is written in full, never cut.
+ *
+ * @param value The value to convert.
+ * @param str A pointer to a buffer of at least width + 1 and NUM_CONV_UINT32_SIZE bytes.
+ * @param width Field width in characters, 0 to NUM_CONV_MAX_WIDTH, 0 for no padding.
+ * @param pad NUM_CONV_PAD_ZERO or NUM_CONV_PAD_SPACE.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: str is NULL or width is out of range.
+ */
+Std_ReturnType Num_Conv_Uint32_To_String_Width(uint32 value, uint8 *str, uint8 width, uint8 pad) {
+    Std_ReturnType ret = E_OK;
+    uint8 digits[NUM_CONV_UINT32_SIZE - 1U];
+    uint8 count;
+
+    if ((NULL == str) || (width > NUM_CONV_MAX_WIDTH)) {
+        ret = E_NOT_OK;
+    } else {
+        count = Num_Conv_Digits(value, digits);
+        Num_Conv_Format(str, digits, count, 0, 0, width, pad);
+    }
+    return ret;
+}
+
+/**
+ * @brief Converts a signed fixed-point value to a decimal string with a point,
+ *        e.g. 2375 with 2 decimals is "23.75" and -5 with 2 decimals is "-0.05".
+ *
+ * The value is the reading scaled by 10^decimals, so sensors keep integer math
+ * and only the point placement happens here. Width and pad work as in
+ * Num_Conv_Uint32_To_String_Width(), the sign and the point count in the width.
+ *
+ * @param value The value scaled by 10^decimals.
+ * @param decimals Digits after the point, 0 to NUM_CONV_MAX_DECIMALS, 0 for no point.
+ * @param str A pointer to a buffer of at least width + 1 and NUM_CONV_FIXED_SIZE bytes.
+ * @param width Field width in characters, 0 to NUM_CONV_MAX_WIDTH, 0 for no padding.
+ * @param pad NUM_CONV_PAD_ZERO or NUM_CONV_PAD_SPACE.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: str is NULL, decimals or width is out of range.
+ */
+Std_ReturnType Num_Conv_Fixed_To_String(sint32 value, uint8 decimals, uint8 *str, uint8 width, uint8 pad) {
+    Std_ReturnType ret = E_OK;
+    uint8 digits[NUM_CONV_UINT32_SIZE - 1U];
+    uint8 negative = (value < 0) ? 1U : 0U;
+    //Negated as unsigned so the most negative value has a magnitude too
+    uint32 magnitude = negative ? (0UL - (uint32) value) : (uint32) value;
+    uint8 count;
+
+    if ((NULL == str) || (decimals > NUM_CONV_MAX_DECIMALS) || (width > NUM_CONV_MAX_WIDTH)) {
+        ret = E_NOT_OK;
+    } else {
+        count = Num_Conv_Digits(magnitude, digits);
+        Num_Conv_Format(str, digits, count, negative, decimals, width, pad);
+    }
+    return ret;
+}
+
+//==================================================
+// Helper Functions
+//==================================================
+
+/**
+ * @brief Extracts the decimal digits of a value as ASCII, most significant first,
+ *        by subtracting powers of ten. No division and no multiplication, and each
+ *        step works in the narrowest type the rest of the value fits.
+ *
+ * @param value The value to convert.
+ * @param digits A pointer to store the digits, 10 bytes, not terminated.
+ * @return The number of digits, at least 1.
+ */
+static uint8 Num_Conv_Digits(uint32 value, uint8 *digits) {
+    uint8 count = 0;
+    uint8 digit;
+    uint8 index;
+    uint16 value16;
+    uint8 value8;
+
+    //A value that fits 16 bits can't reach 10^5, it starts at 10^4
+    index = (value > 0xFFFFUL) ? 0U : (uint8) NUM_CONV_POW10_32_SHORT;
+    for (; index < NUM_CONV_POW10_32_COUNT; index++) {
+        digit = 0;
+        while (value >= num_conv_pow10_32[index]) {
+            value -= num_conv_pow10_32[index];
+            digit++;
+        }
+        if (count || digit) {
+            digits[count++] = (uint8) ('0' + digit);
+        }
+    }
+
+    value16 = (uint16) value;
+    for (index = 0; index < NUM_CONV_POW10_16_COUNT; index++) {
+        digit = 0;
+        while (value16 >= num_conv_pow10_16[index]) {
+            value16 -= num_conv_pow10_16[index];
+            digit++;
+        }
+        if (count || digit) {
+            digits[count++] = (uint8) ('0' + digit);
+        }
+    }
+
+    value8 = (uint8) value16;
+    digit = 0;
+    while (value8 >= 10U) {
+        value8 -= 10U;
+        digit++;
+    }
+    if (count || digit) {
+        digits[count++] = (uint8) ('0' + digit);
+    }
+    digits[count++] = (uint8) ('0' + value8);
+    return count;
+}
+
+/**
+ * @brief Writes sign, padding, digits and the point into the terminated string.
+ *
+ * @param str A pointer to the output buffer.
+ * @param digits The digits from Num_Conv_Digits().
+ * @param count The number of digits.
+ * @param negative 1 to write a minus sign.
+ * @param decimals Digits after the point, 0 for no point.
+ * @param width Field width in characters, 0 for no padding.
+ * @param pad NUM_CONV_PAD_ZERO or NUM_CONV_PAD_SPACE.
+ */
+static void Num_Conv_Format(uint8 *str, const uint8 *digits, uint8 count, uint8 negative,
+                            uint8 decimals, uint8 width, uint8 pad) {
+    //A fraction needs one integer digit, 5 with 2 decimals is 0.05
+    uint8 zeros = (decimals >= count) ? (uint8) (decimals + 1U - count) : 0U;
+    uint8 length = (uint8) (negative + zeros + count + (decimals ? 1U : 0U));
+    uint8 fill = (width > length) ? (uint8) (width - length) : 0U;
+    uint8 remaining;
+
+    if (NUM_CONV_PAD_ZERO == pad) {
+        //Zero padding sits between the sign and the digits
+        zeros += fill;
+    } else {
+        for (; fill; fill--) {
+            *str++ = pad;
+        }
+    }
+    if (negative) {
+        *str++ = '-';
+    }
+    for (remaining = (uint8) (zeros + count); remaining; remaining--) {
+        *str++ = (remaining > count) ? '0' : digits[count - remaining];
+        if (decimals && (remaining == (uint8) (decimals + 1U))) {
+            *str++ = '.';
+        }
+    }
+    *str = '\0';
+}
@@ -0,0 +1,107 @@
+/* 
+ * File:   num_conv.h
+ * Author: Salah-Eldin
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef NUM_CONV_H
+#define	NUM_CONV_H
+
+//==================================================
+// Includes
+//==================================================
+#include "../../MCAL_Layer/std_types.h"
+
+//==================================================
+// Macro Declarations
+//==================================================
+/* Buffer sizes for the widest value of each type, terminator included */
+#define NUM_CONV_UINT8_SIZE         4U      /* "255" */
+#define NUM_CONV_UINT16_SIZE        6U      /* "65535" */
+#define NUM_CONV_UINT32_SIZE        11U     /* "4294967295" */
+#define NUM_CONV_FIXED_SIZE         13U     /* "-2.147483648", sign, 10 digits and the point */
+
+#define NUM_CONV_PAD_ZERO           '0'     /* zeros go after the sign: -0012 */
+#define NUM_CONV_PAD_SPACE          ' '     /* spaces go before the sign: "  -12" */
+
+#define NUM_CONV_MAX_WIDTH          20U
+#define NUM_CONV_MAX_DECIMALS       9U
+
+//==================================================
+// Data Types Declarations
+//==================================================
+
+//==================================================
+// Functions Declarations
+//==================================================
+/**
+ * @brief Converts an 8-bit value to a decimal string without leading zeros.
+ *
+ * @param value The value to convert.
+ * @param str A pointer to a buffer of at least NUM_CONV_UINT8_SIZE bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: str is NULL.
+ */
+Std_ReturnType Num_Conv_Uint8_To_String(uint8 value, uint8 *str);
+
+/**
+ * @brief Converts a 16-bit value to a decimal string without leading zeros.
+ *
+ * @param value The value to convert.
+ * @param str A pointer to a buffer of at least NUM_CONV_UINT16_SIZE bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: str is NULL.
+ */
+Std_ReturnType Num_Conv_Uint16_To_String(uint16 value, uint8 *str);
+
+/**
+ * @brief Converts a 32-bit value to a decimal string without leading zeros.
+ *
+ * @param value The value to convert.
+ * @param str A pointer to a buffer of at least NUM_CONV_UINT32_SIZE bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: str is NULL.
+ */
+Std_ReturnType Num_Conv_Uint32_To_String(uint32 value, uint8 *str);
+
+/**
+ * @brief Converts a 32-bit value to a decimal string right aligned in a fixed width,
+ *        so a reading rewritten in place on the LCD leaves no stale digits behind.
+ *
+ * A value wider than width is written in full, never cut.
+ *
+ * @param value The value to convert.
+ * @param str A pointer to a buffer of at least width + 1 and NUM_CONV_UINT32_SIZE bytes.
+ * @param width Field width in characters, 0 to NUM_CONV_MAX_WIDTH, 0 for no padding.
+ * @param pad NUM_CONV_PAD_ZERO or NUM_CONV_PAD_SPACE.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: str is NULL or width is out of range.
+ */
+Std_ReturnType Num_Conv_Uint32_To_String_Width(uint32 value, uint8 *str, uint8 width, uint8 pad);
+
+/**
+ * @brief Converts a signed fixed-point value to a decimal string with a point,
+ *        e.g. 2375 with 2 decimals is "23.75" and -5 with 2 decimals is "-0.05".
+ *
+ * The value is the reading scaled by 10^decimals, so sensors keep integer math
+ * and only the point placement happens here. Width and pad work as in
+ * Num_Conv_Uint32_To_String_Width(), the sign and the point count in the width.
+ *
+ * @param value The value scaled by 10^decimals.
+ * @param decimals Digits after the point, 0 to NUM_CONV_MAX_DECIMALS, 0 for no point.
+ * @param str A pointer to a buffer of at least width + 1 and NUM_CONV_FIXED_SIZE bytes.
+ * @param width Field width in characters, 0 to NUM_CONV_MAX_WIDTH, 0 for no padding.
+ * @param pad NUM_CONV_PAD_ZERO or NUM_CONV_PAD_SPACE.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: str is NULL, decimals or width is out of range.
+ */
+Std_ReturnType Num_Conv_Fixed_To_String(sint32 value, uint8 decimals, uint8 *str, uint8 width, uint8 pad);
+
+#endif	/* NUM_CONV_H */
+
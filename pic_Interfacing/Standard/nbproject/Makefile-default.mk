@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=APP/application.c ECU_Layer/7_Seg/seven_seg.c ECU_Layer/Button/button.c ECU_Layer/Chr_LCD/chr_lcd.c ECU_Layer/Dc_Motor/dc_motor.c ECU_Layer/Keypad/keypad.c ECU_Layer/LED/led.c ECU_Layer/Relay/relay.c MCAL_Layer/ADC/adc.c MCAL_Layer/CCP/ccp.c MCAL_Layer/EEPROM/eeprom.c MCAL_Layer/GPIO/gpio.c MCAL_Layer/I2C/I2C.c MCAL_Layer/Interrupt/external_interrupt.c MCAL_Layer/Interrupt/internal_interrupt.c MCAL_Layer/Interrupt/interrupt_manager.c MCAL_Layer/SPI/spi.c MCAL_Layer/Timers/timer0.c MCAL_Layer/Timers/timer1.c MCAL_Layer/Timers/timer2.c MCAL_Layer/Timers/timer3.c MCAL_Layer/USART/usart.c MCAL_Layer/device_config.c main.c
+SOURCEFILES_QUOTED_IF_SPACED=APP/application.c ECU_Layer/7_Seg/seven_seg.c ECU_Layer/Button/button.c ECU_Layer/Chr_LCD/chr_lcd.c ECU_Layer/Dc_Motor/dc_motor.c ECU_Layer/EEPROM_Log/eeprom_log.c ECU_Layer/Event_Queue/event_queue.c ECU_Layer/Flash_Log/flash_log.c ECU_Layer/Keypad/keypad.c ECU_Layer/LED/led.c ECU_Layer/Relay/relay.c ECU_Layer/SPI_Flash/spi_flash.c MCAL_Layer/ADC/adc.c MCAL_Layer/ADC/adc_filter.c MCAL_Layer/CCP/ccp.c MCAL_Layer/EEPROM/eeprom.c MCAL_Layer/GPIO/gpio.c MCAL_Layer/I2C/I2C.c MCAL_Layer/Interrupt/external_interrupt.c MCAL_Layer/Interrupt/internal_interrupt.c MCAL_Layer/Interrupt/interrupt_manager.c MCAL_Layer/SPI/spi.c MCAL_Layer/SPI/spi_bus.c MCAL_Layer/Timers/timer0.c MCAL_Layer/Timers/timer1.c MCAL_Layer/Timers/timer2.c MCAL_Layer/Timers/timer3.c MCAL_Layer/Timers/sw_timer.c MCAL_Layer/USART/usart.c MCAL_Layer/device_config.c Utilities/Num_Conv/num_conv.c main.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/APP/application.p1 ${OBJECTDIR}/ECU_Layer/7_Seg/seven_seg.p1 ${OBJECTDIR}/ECU_Layer/Button/button.p1 ${OBJECTDIR}/ECU_Layer/Chr_LCD/chr_lcd.p1 ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1 ${OBJECTDIR}/ECU_Layer/Keypad/keypad.p1 ${OBJECTDIR}/ECU_Layer/LED/led.p1 ${OBJECTDIR}/ECU_Layer/Relay/relay.p1 ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/ccp.p1 ${OBJECTDIR}/MCAL_Layer/EEPROM/eeprom.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/gpio.p1 ${OBJECTDIR}/MCAL_Layer/I2C/I2C.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer0.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer2.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1 ${OBJECTDIR}/MCAL_Layer/USART/usart.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/main.p1
-POSSIBLE_DEPFILES=${OBJECTDIR}/APP/application.p1.d ${OBJECTDIR}/ECU_Layer/7_Seg/seven_seg.p1.d ${OBJECTDIR}/ECU_Layer/Button/button.p1.d ${OBJECTDIR}/ECU_Layer/Chr_LCD/chr_lcd.p1.d ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1.d ${OBJECTDIR}/ECU_Layer/Keypad/keypad.p1.d ${OBJECTDIR}/ECU_Layer/LED/led.p1.d ${OBJECTDIR}/ECU_Layer/Relay/relay.p1.d ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1.d ${OBJECTDIR}/MCAL_Layer/CCP/ccp.p1.d ${OBJECTDIR}/MCAL_Layer/EEPROM/eeprom.p1.d ${OBJECTDIR}/MCAL_Layer/GPIO/gpio.p1.d ${OBJECTDIR}/MCAL_Layer/I2C/I2C.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/external_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/internal_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/interrupt_manager.p1.d ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1.d ${OBJECTDIR}/MCAL_Layer/Timers/timer0.p1.d ${OBJECTDIR}/MCAL_Layer/Timers/timer1.p1.d ${OBJECTDIR}/MCAL_Layer/Timers/timer2.p1.d ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1.d ${OBJECTDIR}/MCAL_Layer/USART/usart.p1.d ${OBJECTDIR}/MCAL_Layer/device_config.p1.d ${OBJECTDIR}/main.p1.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/APP/application.p1 ${OBJECTDIR}/ECU_Layer/7_Seg/seven_seg.p1 ${OBJECTDIR}/ECU_Layer/Button/button.p1 ${OBJECTDIR}/ECU_Layer/Chr_LCD/chr_lcd.p1 ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1 ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1 ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1 ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1 ${OBJECTDIR}/ECU_Layer/Keypad/keypad.p1 ${OBJECTDIR}/ECU_Layer/LED/led.p1 ${OBJECTDIR}/ECU_Layer/Relay/relay.p1 ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1 ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1 ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1 ${OBJECTDIR}/MCAL_Layer/CCP/ccp.p1 ${OBJECTDIR}/MCAL_Layer/EEPROM/eeprom.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/gpio.p1 ${OBJECTDIR}/MCAL_Layer/I2C/I2C.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1 ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer0.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer2.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1 ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1 ${OBJECTDIR}/MCAL_Layer/USART/usart.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1 ${OBJECTDIR}/main.p1
+POSSIBLE_DEPFILES=${OBJECTDIR}/APP/application.p1.d ${OBJECTDIR}/ECU_Layer/7_Seg/seven_seg.p1.d ${OBJECTDIR}/ECU_Layer/Button/button.p1.d ${OBJECTDIR}/ECU_Layer/Chr_LCD/chr_lcd.p1.d ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1.d ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1.d ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1.d ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1.d ${OBJECTDIR}/ECU_Layer/Keypad/keypad.p1.d ${OBJECTDIR}/ECU_Layer/LED/led.p1.d ${OBJECTDIR}/ECU_Layer/Relay/relay.p1.d ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1.d ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1.d ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1.d ${OBJECTDIR}/MCAL_Layer/CCP/ccp.p1.d ${OBJECTDIR}/MCAL_Layer/EEPROM/eeprom.p1.d ${OBJECTDIR}/MCAL_Layer/GPIO/gpio.p1.d ${OBJECTDIR}/MCAL_Layer/I2C/I2C.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/external_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/internal_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/interrupt_manager.p1.d.d ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1.d ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1.d ${OBJECTDIR}/MCAL_Layer/Timers/timer0.p1.d ${OBJECTDIR}/MCAL_Layer/Timers/timer1.p1.d ${OBJECTDIR}/MCAL_Layer/Timers/timer2.p1.d ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1.d ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1.d ${OBJECTDIR}/MCAL_Layer/USART/usart.p1.d ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1.d ${OBJECTDIR}/main.p1.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/APP/application.p1 ${OBJECTDIR}/ECU_Layer/7_Seg/seven_seg.p1 ${OBJECTDIR}/ECU_Layer/Button/button.p1 ${OBJECTDIR}/ECU_Layer/Chr_LCD/chr_lcd.p1 ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1 ${OBJECTDIR}/ECU_Layer/Keypad/keypad.p1 ${OBJECTDIR}/ECU_Layer/LED/led.p1 ${OBJECTDIR}/ECU_Layer/Relay/relay.p1 ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/ccp.p1 ${OBJECTDIR}/MCAL_Layer/EEPROM/eeprom.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/gpio.p1 ${OBJECTDIR}/MCAL_Layer/I2C/I2C.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer0.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer2.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1 ${OBJECTDIR}/MCAL_Layer/USART/usart.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/main.p1
+OBJECTFILES=${OBJECTDIR}/APP/application.p1 ${OBJECTDIR}/ECU_Layer/7_Seg/seven_seg.p1 ${OBJECTDIR}/ECU_Layer/Button/button.p1 ${OBJECTDIR}/ECU_Layer/Chr_LCD/chr_lcd.p1 ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1 ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1 ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1 ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1 ${OBJECTDIR}/ECU_Layer/Keypad/keypad.p1 ${OBJECTDIR}/ECU_Layer/LED/led.p1 ${OBJECTDIR}/ECU_Layer/Relay/relay.p1 ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1 ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1 ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1 ${OBJECTDIR}/MCAL_Layer/CCP/ccp.p1 ${OBJECTDIR}/MCAL_Layer/EEPROM/eeprom.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/gpio.p1 ${OBJECTDIR}/MCAL_Layer/I2C/I2C.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1 ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer0.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer2.p1 ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1 ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1 ${OBJECTDIR}/MCAL_Layer/USART/usart.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1 ${OBJECTDIR}/main.p1
 
 # Source Files
-SOURCEFILES=APP/application.c ECU_Layer/7_Seg/seven_seg.c ECU_Layer/Button/button.c ECU_Layer/Chr_LCD/chr_lcd.c ECU_Layer/Dc_Motor/dc_motor.c ECU_Layer/Keypad/keypad.c ECU_Layer/LED/led.c ECU_Layer/Relay/relay.c MCAL_Layer/ADC/adc.c MCAL_Layer/CCP/ccp.c MCAL_Layer/EEPROM/eeprom.c MCAL_Layer/GPIO/gpio.c MCAL_Layer/I2C/I2C.c MCAL_Layer/Interrupt/external_interrupt.c MCAL_Layer/Interrupt/internal_interrupt.c MCAL_Layer/Interrupt/interrupt_manager.c MCAL_Layer/SPI/spi.c MCAL_Layer/Timers/timer0.c MCAL_Layer/Timers/timer1.c MCAL_Layer/Timers/timer2.c MCAL_Layer/Timers/timer3.c MCAL_Layer/USART/usart.c MCAL_Layer/device_config.c main.c
+SOURCEFILES=APP/application.c ECU_Layer/7_Seg/seven_seg.c ECU_Layer/Button/button.c ECU_Layer/Chr_LCD/chr_lcd.c ECU_Layer/Dc_Motor/dc_motor.c ECU_Layer/EEPROM_Log/eeprom_log.c ECU_Layer/Event_Queue/event_queue.c ECU_Layer/Flash_Log/flash_log.c ECU_Layer/Keypad/keypad.c ECU_Layer/LED/led.c ECU_Layer/Relay/relay.c ECU_Layer/SPI_Flash/spi_flash.c MCAL_Layer/ADC/adc.c MCAL_Layer/ADC/adc_filter.c MCAL_Layer/CCP/ccp.c MCAL_Layer/EEPROM/eeprom.c MCAL_Layer/GPIO/gpio.c MCAL_Layer/I2C/I2C.c MCAL_Layer/Interrupt/external_interrupt.c MCAL_Layer/Interrupt/internal_interrupt.c MCAL_Layer/Interrupt/interrupt_manager.c MCAL_Layer/SPI/spi.c MCAL_Layer/SPI/spi_bus.c MCAL_Layer/Timers/timer0.c MCAL_Layer/Timers/timer1.c MCAL_Layer/Timers/timer2.c MCAL_Layer/Timers/timer3.c MCAL_Layer/Timers/sw_timer.c MCAL_Layer/USART/usart.c MCAL_Layer/device_config.c Utilities/Num_Conv/num_conv.c main.c
 
 
 
@@ -128,6 +128,30 @@ ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1: ECU_Layer/Dc_Motor/dc_motor.c  nbpr
 	@-${MV} ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.d ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1: ECU_Layer/EEPROM_Log/eeprom_log.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/EEPROM_Log" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1 ECU_Layer/EEPROM_Log/eeprom_log.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.d ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1: ECU_Layer/Event_Queue/event_queue.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Event_Queue" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1 ECU_Layer/Event_Queue/event_queue.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.d ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1: ECU_Layer/Flash_Log/flash_log.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Flash_Log" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1 ECU_Layer/Flash_Log/flash_log.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.d ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/ECU_Layer/Keypad/keypad.p1: ECU_Layer/Keypad/keypad.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Keypad" 
 	@${RM} ${OBJECTDIR}/ECU_Layer/Keypad/keypad.p1.d 
@@ -152,6 +176,14 @@ ${OBJECTDIR}/ECU_Layer/Relay/relay.p1: ECU_Layer/Relay/relay.c  nbproject/Makefi
 	@-${MV} ${OBJECTDIR}/ECU_Layer/Relay/relay.d ${OBJECTDIR}/ECU_Layer/Relay/relay.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Relay/relay.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1: ECU_Layer/SPI_Flash/spi_flash.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/SPI_Flash" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1 ECU_Layer/SPI_Flash/spi_flash.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.d ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1: MCAL_Layer/ADC/adc.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
 	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1.d 
@@ -160,6 +192,14 @@ ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1: MCAL_Layer/ADC/adc.c  nbproject/Makefile-${C
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/adc.d ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1: MCAL_Layer/ADC/adc_filter.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1 MCAL_Layer/ADC/adc_filter.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.d ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/MCAL_Layer/CCP/ccp.p1: MCAL_Layer/CCP/ccp.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/CCP" 
 	@${RM} ${OBJECTDIR}/MCAL_Layer/CCP/ccp.p1.d 
@@ -224,6 +264,14 @@ ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1: MCAL_Layer/SPI/spi.c  nbproject/Makefile-${C
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/SPI/spi.d ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1: MCAL_Layer/SPI/spi_bus.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/SPI" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1 MCAL_Layer/SPI/spi_bus.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.d ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/MCAL_Layer/Timers/timer0.p1: MCAL_Layer/Timers/timer0.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timers" 
 	@${RM} ${OBJECTDIR}/MCAL_Layer/Timers/timer0.p1.d 
@@ -256,6 +304,14 @@ ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1: MCAL_Layer/Timers/timer3.c  nbproject/
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timers/timer3.d ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1: MCAL_Layer/Timers/sw_timer.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timers" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1 MCAL_Layer/Timers/sw_timer.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.d ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/MCAL_Layer/USART/usart.p1: MCAL_Layer/USART/usart.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/USART" 
 	@${RM} ${OBJECTDIR}/MCAL_Layer/USART/usart.p1.d 
@@ -272,6 +328,14 @@ ${OBJECTDIR}/MCAL_Layer/device_config.p1: MCAL_Layer/device_config.c  nbproject/
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/device_config.d ${OBJECTDIR}/MCAL_Layer/device_config.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/device_config.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1: Utilities/Num_Conv/num_conv.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Utilities/Num_Conv" 
+	@${RM} ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1.d 
+	@${RM} ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1 Utilities/Num_Conv/num_conv.c 
+	@-${MV} ${OBJECTDIR}/Utilities/Num_Conv/num_conv.d ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/main.p1: main.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/main.p1.d 
@@ -321,6 +385,30 @@ ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1: ECU_Layer/Dc_Motor/dc_motor.c  nbpr
 	@-${MV} ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.d ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Dc_Motor/dc_motor.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1: ECU_Layer/EEPROM_Log/eeprom_log.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/EEPROM_Log" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1 ECU_Layer/EEPROM_Log/eeprom_log.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.d ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/EEPROM_Log/eeprom_log.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1: ECU_Layer/Event_Queue/event_queue.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Event_Queue" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1 ECU_Layer/Event_Queue/event_queue.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.d ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Event_Queue/event_queue.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1: ECU_Layer/Flash_Log/flash_log.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Flash_Log" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1 ECU_Layer/Flash_Log/flash_log.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.d ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Flash_Log/flash_log.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/ECU_Layer/Keypad/keypad.p1: ECU_Layer/Keypad/keypad.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Keypad" 
 	@${RM} ${OBJECTDIR}/ECU_Layer/Keypad/keypad.p1.d 
@@ -345,6 +433,14 @@ ${OBJECTDIR}/ECU_Layer/Relay/relay.p1: ECU_Layer/Relay/relay.c  nbproject/Makefi
 	@-${MV} ${OBJECTDIR}/ECU_Layer/Relay/relay.d ${OBJECTDIR}/ECU_Layer/Relay/relay.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Relay/relay.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1: ECU_Layer/SPI_Flash/spi_flash.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/SPI_Flash" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1 ECU_Layer/SPI_Flash/spi_flash.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.d ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/SPI_Flash/spi_flash.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1: MCAL_Layer/ADC/adc.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
 	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1.d 
@@ -353,6 +449,14 @@ ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1: MCAL_Layer/ADC/adc.c  nbproject/Makefile-${C
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/adc.d ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/adc.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1: MCAL_Layer/ADC/adc_filter.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1 MCAL_Layer/ADC/adc_filter.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.d ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/adc_filter.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/MCAL_Layer/CCP/ccp.p1: MCAL_Layer/CCP/ccp.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/CCP" 
 	@${RM} ${OBJECTDIR}/MCAL_Layer/CCP/ccp.p1.d 
@@ -417,6 +521,14 @@ ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1: MCAL_Layer/SPI/spi.c  nbproject/Makefile-${C
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/SPI/spi.d ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/SPI/spi.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1: MCAL_Layer/SPI/spi_bus.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/SPI" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1 MCAL_Layer/SPI/spi_bus.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.d ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/SPI/spi_bus.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/MCAL_Layer/Timers/timer0.p1: MCAL_Layer/Timers/timer0.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timers" 
 	@${RM} ${OBJECTDIR}/MCAL_Layer/Timers/timer0.p1.d 
@@ -449,6 +561,14 @@ ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1: MCAL_Layer/Timers/timer3.c  nbproject/
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timers/timer3.d ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timers/timer3.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1: MCAL_Layer/Timers/sw_timer.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timers" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1 MCAL_Layer/Timers/sw_timer.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.d ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timers/sw_timer.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/MCAL_Layer/USART/usart.p1: MCAL_Layer/USART/usart.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/USART" 
 	@${RM} ${OBJECTDIR}/MCAL_Layer/USART/usart.p1.d 
@@ -465,6 +585,14 @@ ${OBJECTDIR}/MCAL_Layer/device_config.p1: MCAL_Layer/device_config.c  nbproject/
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/device_config.d ${OBJECTDIR}/MCAL_Layer/device_config.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/device_config.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1: Utilities/Num_Conv/num_conv.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Utilities/Num_Conv" 
+	@${RM} ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1.d 
+	@${RM} ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1 Utilities/Num_Conv/num_conv.c 
+	@-${MV} ${OBJECTDIR}/Utilities/Num_Conv/num_conv.d ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Utilities/Num_Conv/num_conv.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/main.p1: main.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/main.p1.d 